@@ -24,6 +24,14 @@
 #define CL_KERNEL_EXEC_INFO_DEFAULT_TYPE_INTEL 0x1000D
 #define CL_KERNEL_EXEC_INFO_CONCURRENT_TYPE_INTEL 0x1000E
 
+/*************************************
+ * Internal only platform properties *
+ *************************************/
+// cl_ulong array with values of process-wide runtime counters
+#define CL_PLATFORM_RUNTIME_COUNTERS_INTEL 0x10030
+// new line separated names of runtime counters, in the order of values
+#define CL_PLATFORM_RUNTIME_COUNTER_NAMES_INTEL 0x10031
+
 /*********************************
  * cl_intel_debug_info extension *
  *********************************/
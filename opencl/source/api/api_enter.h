@@ -6,11 +6,13 @@
  */
 
 #include "shared/source/utilities/perf_profiler.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "opencl/source/utilities/logger.h"
 
-#define API_ENTER(retValPointer) \
-    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                                           \
+    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    NEO::TraceRecorderScope traceRecorderScopeForSingleApiCall(NEO::TraceCategory::api, __FUNCTION__)
 
 #if KMD_PROFILING == 1
 #undef API_ENTER
@@ -21,6 +21,7 @@
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/source/command_queue/command_sequence.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/device/cl_device.h"
 #include "opencl/source/device_queue/device_queue.h"
@@ -43,6 +44,8 @@ namespace NEO {
 // Global table of create functions
 CommandQueueCreateFunc commandQueueFactory[IGFX_MAX_CORE] = {};
 
+std::atomic<uint64_t> CommandQueue::timestampPacketTimelineIdCounter{0u};
+
 CommandQueue *CommandQueue::create(Context *context,
                                    ClDevice *device,
                                    const cl_queue_properties *properties,
@@ -57,7 +60,7 @@ CommandQueue *CommandQueue::create(Context *context,
 }
 
 CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_properties *properties)
-    : context(context), device(device) {
+    : context(context), device(device), timestampPacketTimelineId(++timestampPacketTimelineIdCounter) {
     if (context) {
         context->incRefInternal();
     }
@@ -100,6 +103,7 @@ CommandQueue::~CommandQueue() {
     }
 
     timestampPacketContainer.reset();
+    recordedCommandSequence.reset();
     //for normal queue, decrement ref count on context
     //special queue is owned by context so ref count doesn't have to be decremented
     if (context && !isSpecialCommandQueue) {
@@ -107,6 +111,18 @@ CommandQueue::~CommandQueue() {
     }
 }
 
+cl_int CommandQueue::beginRecording() {
+    if (isRecording()) {
+        return CL_INVALID_OPERATION;
+    }
+    recordedCommandSequence = std::make_unique<CommandSequence>();
+    return CL_SUCCESS;
+}
+
+std::unique_ptr<CommandSequence> CommandQueue::endRecording() {
+    return std::move(recordedCommandSequence);
+}
+
 CommandStreamReceiver &CommandQueue::getGpgpuCommandStreamReceiver() const {
     return *gpgpuEngine->commandStreamReceiver;
 }
@@ -536,8 +552,16 @@ void CommandQueue::obtainNewTimestampPacketNodes(size_t numberOfNodes, Timestamp
 
     DEBUG_BREAK_IF(timestampPacketContainer->peekNodes().size() > 0);
 
+    if (clearAllDependencies) {
+        // new nodes don't wait for previous ones, so they can't be ordered with them
+        timestampPacketTimelineId = ++timestampPacketTimelineIdCounter;
+    }
+    timestampPacketTimelineSequence++;
+
     for (size_t i = 0; i < numberOfNodes; i++) {
-        timestampPacketContainer->add(allocator->getTag());
+        auto node = allocator->getTag();
+        node->setTimeline(timestampPacketTimelineId, timestampPacketTimelineSequence);
+        timestampPacketContainer->add(node);
     }
 }
 
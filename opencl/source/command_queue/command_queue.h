@@ -15,12 +15,14 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 
 namespace NEO {
 class BarrierCommand;
 class Buffer;
 class LinearStream;
 class ClDevice;
+class CommandSequence;
 class Context;
 class Device;
 class Event;
@@ -198,6 +200,15 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     virtual cl_int flush() = 0;
 
+    virtual cl_int enqueueCommandSequence(CommandSequence &commandSequence, cl_uint numEventsInWaitList,
+                                          const cl_event *eventWaitList, cl_event *event) {
+        return CL_INVALID_OPERATION;
+    }
+
+    cl_int beginRecording();
+    std::unique_ptr<CommandSequence> endRecording();
+    bool isRecording() const { return recordedCommandSequence != nullptr; }
+
     MOCKABLE_VIRTUAL void updateFromCompletionStamp(const CompletionStamp &completionStamp);
 
     virtual bool isCacheFlushCommand(uint32_t commandType) const { return false; }
@@ -348,6 +359,11 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool requiresCacheFlushAfterWalker = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+    std::unique_ptr<CommandSequence> recordedCommandSequence;
+
+    static std::atomic<uint64_t> timestampPacketTimelineIdCounter;
+    uint64_t timestampPacketTimelineId = 0;
+    uint64_t timestampPacketTimelineSequence = 0;
 };
 
 using CommandQueueCreateFunc = CommandQueue *(*)(Context *context, ClDevice *device, const cl_queue_properties *properties, bool internalUsage);
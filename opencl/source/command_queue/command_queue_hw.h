@@ -311,6 +311,11 @@ class CommandQueueHw : public CommandQueue {
                                       cl_event *event) override;
     cl_int flush() override;
 
+    cl_int enqueueCommandSequence(CommandSequence &commandSequence,
+                                  cl_uint numEventsInWaitList,
+                                  const cl_event *eventWaitList,
+                                  cl_event *event) override;
+
     template <uint32_t enqueueType>
     void enqueueHandler(Surface **surfacesForResidency,
                         size_t numSurfaceForResidency,
@@ -414,6 +419,13 @@ class CommandQueueHw : public CommandQueue {
 
     MOCKABLE_VIRTUAL bool forceStateless(size_t size);
 
+    void buildCommandSequenceDispatchInfo(CommandSequence &commandSequence, MultiDispatchInfo &multiDispatchInfo,
+                                          KernelOperation *recordedCommands);
+    bool isCommandSequenceReplayAllowed(cl_uint numEventsInWaitList, const cl_event *event) const;
+    bool replayCommandSequence(CommandSequence &commandSequence, cl_event *event);
+    void recordCommandSequence(CommandSequence &commandSequence);
+    void patchRecordedCommandSequence(CommandSequence &commandSequence);
+
     template <uint32_t commandType>
     LinearStream *obtainCommandStream(const CsrDependencies &csrDependencies, bool blitEnqueue, bool blockedQueue,
                                       const MultiDispatchInfo &multiDispatchInfo, const EventsRequest &eventsRequest,
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/command_sequence.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/kernel/grf_config.h"
+
+#include "opencl/source/helpers/task_information.h"
+#include "opencl/source/kernel/kernel.h"
+#include "opencl/source/program/kernel_info.h"
+#include "opencl/source/program/program.h"
+
+namespace NEO {
+
+namespace {
+uint32_t getNumGrfRequired(const Kernel &kernel) {
+    auto executionEnvironment = kernel.getKernelInfo().patchInfo.executionEnvironment;
+    return executionEnvironment ? executionEnvironment->NumGRFRequired : GrfConfig::DefaultGrfNumber;
+}
+} // namespace
+
+CommandSequence::RecordedCommands::RecordedCommands() = default;
+CommandSequence::RecordedCommands::~RecordedCommands() = default;
+
+CommandSequence::~CommandSequence() {
+    releaseRecordedCommands();
+    for (auto &dispatch : dispatches) {
+        dispatch.kernel->release();
+    }
+}
+
+cl_int CommandSequence::recordKernel(Kernel &kernel, uint32_t workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                                     const size_t *localWorkSize, const size_t *enqueuedLocalWorkSize) {
+    if (kernel.isParentKernel) {
+        return CL_INVALID_OPERATION;
+    }
+
+    cl_int retVal = CL_SUCCESS;
+    auto clonedKernel = Kernel::create(kernel.getProgram(), kernel.getKernelInfo(), &retVal);
+    if (clonedKernel == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+    retVal = clonedKernel->cloneKernel(&kernel);
+    if (retVal != CL_SUCCESS) {
+        clonedKernel->release();
+        return retVal;
+    }
+
+    RecordedDispatch dispatch;
+    dispatch.kernel = clonedKernel;
+    dispatch.workDim = workDim;
+    dispatch.localWorkSizeSpecified = (localWorkSize != nullptr);
+    for (uint32_t i = 0; i < workDim; i++) {
+        dispatch.globalWorkOffset[i] = globalWorkOffset[i];
+        dispatch.globalWorkSize[i] = globalWorkSize[i];
+        dispatch.localWorkSize[i] = localWorkSize ? localWorkSize[i] : 0;
+        dispatch.enqueuedLocalWorkSize[i] = enqueuedLocalWorkSize[i];
+    }
+    dispatches.push_back(dispatch);
+    return CL_SUCCESS;
+}
+
+cl_int CommandSequence::setKernelArg(size_t dispatchIndex, uint32_t argIndex, size_t argSize, const void *argValue) {
+    if (dispatchIndex >= dispatches.size()) {
+        return CL_INVALID_VALUE;
+    }
+    auto kernel = dispatches[dispatchIndex].kernel;
+    if (argIndex >= kernel->getKernelArgsNumber()) {
+        return CL_INVALID_ARG_INDEX;
+    }
+    auto retVal = kernel->setArg(argIndex, argSize, argValue);
+    if (retVal == CL_SUCCESS) {
+        dispatches[dispatchIndex].argsChanged = true;
+    }
+    return retVal;
+}
+
+size_t CommandSequence::getPatchedSurfaceStatesSize(const Kernel &kernel) {
+    // binding table is rebased when it is pushed into the heap, so only the surface states in front of it are patched
+    auto bindingTableState = kernel.getKernelInfo().patchInfo.bindingTableState;
+    return (bindingTableState != nullptr && bindingTableState->Count > 0) ? kernel.getBindingTableOffset() : 0u;
+}
+
+bool CommandSequence::isSingleSubmissionAllowed() const {
+    if (dispatches.empty()) {
+        return true;
+    }
+    auto firstKernel = dispatches[0].kernel;
+    for (auto &dispatch : dispatches) {
+        auto kernel = dispatch.kernel;
+        if (kernel->getKernelInfo().builtinDispatchBuilder != nullptr ||
+            kernel->hasPrintfOutput() ||
+            kernel->usesSyncBuffer() ||
+            kernel->isAuxTranslationRequired() ||
+            kernel->getProgram()->isKernelDebugEnabled()) {
+            return false;
+        }
+        // state programmed once per submission has to be the same for every kernel
+        if (kernel->slmTotalSize != firstKernel->slmTotalSize ||
+            getNumGrfRequired(*kernel) != getNumGrfRequired(*firstKernel) ||
+            kernel->isVmeKernel() != firstKernel->isVmeKernel() ||
+            kernel->requiresSpecialPipelineSelectMode() != firstKernel->requiresSpecialPipelineSelectMode() ||
+            kernel->getThreadArbitrationPolicy() != firstKernel->getThreadArbitrationPolicy() ||
+            kernel->areStatelessWritesUsed() != firstKernel->areStatelessWritesUsed()) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace NEO
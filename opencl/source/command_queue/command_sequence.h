@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/helpers/completion_stamp.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "CL/cl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Kernel;
+struct KernelOperation;
+
+// Sequence of NDRange dispatches captured by a command queue between beginRecording() and endRecording().
+// Every recorded dispatch owns a clone of the enqueued kernel, so its arguments are frozen at record time
+// and can be patched individually before the sequence is enqueued with enqueueCommandSequence().
+// When isSingleSubmissionAllowed() returns true, commands of all dispatches are programmed once into their own
+// command buffer and heaps (RecordedCommands) and every later enqueue only jumps to them with a second level
+// batch buffer start. Dispatches with changed arguments get their cross thread data and surface states patched
+// in place, dispatches which can't be patched cause the commands to be recorded again.
+class CommandSequence : NonCopyableOrMovableClass {
+  public:
+    struct RecordedDispatch {
+        Kernel *kernel = nullptr;
+        uint32_t workDim = 0;
+        size_t globalWorkOffset[3] = {0, 0, 0};
+        size_t globalWorkSize[3] = {1, 1, 1};
+        size_t localWorkSize[3] = {0, 0, 0};
+        size_t enqueuedLocalWorkSize[3] = {0, 0, 0};
+        bool localWorkSizeSpecified = false;
+
+        // location of the dispatch's indirect data in the recorded heaps, valid only when patchable is set
+        size_t crossThreadDataOffset = 0;
+        size_t surfaceStateOffset = 0;
+        uint32_t recordedSlmTotalSize = 0;
+        bool patchable = false;
+        bool argsChanged = false;
+    };
+
+    struct RecordedCommands {
+        RecordedCommands();
+        ~RecordedCommands();
+
+        std::unique_ptr<KernelOperation> kernelOperation;
+        CommandStreamReceiver *commandStreamReceiver = nullptr;
+        PreemptionMode preemptionMode = PreemptionMode::Initial;
+        uint32_t scratchSize = 0;
+        uint32_t privateScratchSize = 0;
+        bool usesSlm = false;
+
+        // heaps can't be patched before the previous replay completes
+        uint32_t taskCount = 0;
+        FlushStamp flushStamp = 0;
+    };
+
+    CommandSequence() = default;
+    ~CommandSequence();
+
+    cl_int recordKernel(Kernel &kernel, uint32_t workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                        const size_t *localWorkSize, const size_t *enqueuedLocalWorkSize);
+    cl_int setKernelArg(size_t dispatchIndex, uint32_t argIndex, size_t argSize, const void *argValue);
+
+    bool isSingleSubmissionAllowed() const;
+    static size_t getPatchedSurfaceStatesSize(const Kernel &kernel);
+
+    size_t getDispatchesCount() const { return dispatches.size(); }
+    bool empty() const { return dispatches.empty(); }
+    const RecordedDispatch &getDispatch(size_t dispatchIndex) const { return dispatches[dispatchIndex]; }
+    RecordedDispatch &getDispatch(size_t dispatchIndex) { return dispatches[dispatchIndex]; }
+
+    RecordedCommands *getRecordedCommands() const { return recordedCommands.get(); }
+    void setRecordedCommands(std::unique_ptr<RecordedCommands> &&commands) { recordedCommands = std::move(commands); }
+    void releaseRecordedCommands() { recordedCommands.reset(); }
+
+  protected:
+    std::vector<RecordedDispatch> dispatches;
+    std::unique_ptr<RecordedCommands> recordedCommands;
+};
+} // namespace NEO
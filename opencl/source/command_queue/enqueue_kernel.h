@@ -7,10 +7,18 @@
 
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/command_queue/command_queue_hw.h"
+#include "opencl/source/command_queue/command_sequence.h"
 #include "opencl/source/command_queue/gpgpu_walker.h"
+#include "opencl/source/command_queue/hardware_interface.h"
+#include "opencl/source/event/event_builder.h"
+#include "opencl/source/gtpin/gtpin_notify.h"
+#include "opencl/source/helpers/dispatch_info_builder.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/task_information.h"
 #include "opencl/source/mem_obj/buffer.h"
@@ -134,6 +142,13 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         return CL_INVALID_WORK_GROUP_SIZE;
     }
 
+    if (isRecording()) {
+        if (numEventsInWaitList != 0 || event != nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return recordedCommandSequence->recordKernel(kernel, workDim, globalWorkOffset, region, localWkgSizeToPass, enqueuedLocalWorkSize);
+    }
+
     enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(
         surfaces,
         false,
@@ -149,4 +164,373 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
 
     return CL_SUCCESS;
 }
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueCommandSequence(CommandSequence &commandSequence,
+                                                         cl_uint numEventsInWaitList,
+                                                         const cl_event *eventWaitList,
+                                                         cl_event *event) {
+    if (isRecording()) {
+        return CL_INVALID_OPERATION;
+    }
+
+    if (commandSequence.empty()) {
+        auto retVal = enqueueMarkerWithWaitList(numEventsInWaitList, eventWaitList, event);
+        if (event) {
+            castToObjectOrAbort<Event>(*event)->setCmdType(CL_COMMAND_NDRANGE_KERNEL);
+        }
+        return retVal;
+    }
+
+    auto singleSubmission = commandSequence.isSingleSubmissionAllowed();
+    if (DebugManager.flags.EnableCommandSequenceSingleSubmission.get() != -1) {
+        singleSubmission &= !!DebugManager.flags.EnableCommandSequenceSingleSubmission.get();
+    }
+
+    const auto dispatchesCount = commandSequence.getDispatchesCount();
+    for (size_t dispatchIndex = 0; dispatchIndex < dispatchesCount; dispatchIndex++) {
+        auto &dispatch = commandSequence.getDispatch(dispatchIndex);
+        auto kernel = dispatch.kernel;
+        if (!kernel->isPatched()) {
+            if (event) {
+                *event = nullptr;
+            }
+            return CL_INVALID_KERNEL_ARGS;
+        }
+        if (kernel->isUsingSharedObjArgs()) {
+            kernel->resetSharedObjectsPatchAddresses();
+            dispatch.argsChanged = true;
+        }
+        if (dispatchIndex > 0 && kernel->requiresCacheFlushCommand(*this)) {
+            singleSubmission = false;
+        }
+    }
+
+    NullSurface s;
+    Surface *surfaces[] = {&s};
+
+    if (!singleSubmission) {
+        for (size_t dispatchIndex = 0; dispatchIndex < dispatchesCount; dispatchIndex++) {
+            auto &dispatch = commandSequence.getDispatch(dispatchIndex);
+            bool isFirst = (dispatchIndex == 0);
+            bool isLast = (dispatchIndex + 1 == dispatchesCount);
+            enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(
+                surfaces,
+                false,
+                dispatch.kernel,
+                dispatch.workDim,
+                dispatch.globalWorkOffset,
+                dispatch.globalWorkSize,
+                dispatch.localWorkSizeSpecified ? dispatch.localWorkSize : nullptr,
+                dispatch.enqueuedLocalWorkSize,
+                isFirst ? numEventsInWaitList : 0,
+                isFirst ? eventWaitList : nullptr,
+                isLast ? event : nullptr);
+        }
+        return CL_SUCCESS;
+    }
+
+    if (isCommandSequenceReplayAllowed(numEventsInWaitList, event) && replayCommandSequence(commandSequence, event)) {
+        return CL_SUCCESS;
+    }
+
+    MultiDispatchInfo multiDispatchInfo(commandSequence.getDispatch(0).kernel);
+    buildCommandSequenceDispatchInfo(commandSequence, multiDispatchInfo, nullptr);
+
+    enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(surfaces, false, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
+
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::buildCommandSequenceDispatchInfo(CommandSequence &commandSequence, MultiDispatchInfo &multiDispatchInfo,
+                                                                 KernelOperation *recordedCommands) {
+    using BINDING_TABLE_STATE = typename GfxFamily::BINDING_TABLE_STATE;
+
+    // Walkers of all recorded dispatches are programmed into the same command buffer and submitted with one flush,
+    // in-order semantics between consecutive dispatches are preserved with a PIPE_CONTROL.
+    // Per submission state is taken from the first kernel, isSingleSubmissionAllowed() guarantees it is common for all of them.
+    const auto dispatchesCount = commandSequence.getDispatchesCount();
+    for (size_t dispatchIndex = 0; dispatchIndex < dispatchesCount; dispatchIndex++) {
+        auto &dispatch = commandSequence.getDispatch(dispatchIndex);
+        const auto dispatchInfosCount = multiDispatchInfo.size();
+
+        DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder;
+        builder.setDispatchGeometry(dispatch.workDim, dispatch.globalWorkSize, dispatch.enqueuedLocalWorkSize, dispatch.globalWorkOffset,
+                                    Vec3<size_t>{0, 0, 0}, dispatch.localWorkSizeSpecified ? dispatch.localWorkSize : nullptr);
+        builder.setKernel(dispatch.kernel);
+        builder.bake(multiDispatchInfo);
+
+        if (recordedCommands) {
+            dispatch.crossThreadDataOffset = 0;
+            dispatch.surfaceStateOffset = 0;
+            dispatch.recordedSlmTotalSize = dispatch.kernel->slmTotalSize;
+            dispatch.patchable = false;
+            dispatch.argsChanged = false;
+
+            // indirect data of dispatches split into many walkers or using samplers can't be patched in place,
+            // for the rest remember where it is pushed, sendIndirectState() aligns both heaps before pushing
+            if (multiDispatchInfo.size() == dispatchInfosCount + 1 &&
+                dispatch.kernel->getKernelInfo().patchInfo.samplerStateArray == nullptr) {
+                multiDispatchInfo.rbegin()->dispatchInitCommands.registerMethod(
+                    [recordedCommands, &dispatch](LinearStream &, TimestampPacketDependencies *) {
+                        dispatch.crossThreadDataOffset = alignUp(recordedCommands->ioh->getUsed(), WALKER_TYPE<GfxFamily>::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
+                        dispatch.surfaceStateOffset = alignUp(recordedCommands->ssh->getUsed(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+                        dispatch.patchable = true;
+                    });
+            }
+        }
+
+        if (dispatchIndex + 1 < dispatchesCount) {
+            multiDispatchInfo.rbegin()->dispatchEpilogueCommands.registerMethod(
+                [](LinearStream &commandStream, TimestampPacketDependencies *) {
+                    MemorySynchronizationCommands<GfxFamily>::addPipeControl(commandStream, false);
+                });
+            multiDispatchInfo.rbegin()->dispatchEpilogueCommands.registerCommandsSizeEstimationMethod(
+                [](size_t) {
+                    return MemorySynchronizationCommands<GfxFamily>::getSizeForSinglePipeControl();
+                });
+        }
+    }
+}
+
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::isCommandSequenceReplayAllowed(cl_uint numEventsInWaitList, const cl_event *event) const {
+    // recorded commands are replayed as they are, so nothing programmed per enqueue may be required
+    if (numEventsInWaitList > 0 ||
+        (event && (isProfilingEnabled() || isPerfCountersEnabled())) ||
+        getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled() ||
+        gtpinIsGTPinInitialized() ||
+        DebugManager.flags.AUBDumpSubCaptureMode.get() ||
+        DebugManager.flags.AddPatchInfoCommentsForAUBDump.get() ||
+        DebugManager.flags.FlattenBatchBufferForAUBDump.get()) {
+        return false;
+    }
+    return true;
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::recordCommandSequence(CommandSequence &commandSequence) {
+    using MI_BATCH_BUFFER_END = typename GfxFamily::MI_BATCH_BUFFER_END;
+
+    auto &commandStreamReceiver = getGpgpuCommandStreamReceiver();
+    commandSequence.releaseRecordedCommands();
+
+    auto recordedCommands = std::make_unique<CommandSequence::RecordedCommands>();
+    auto commandStream = new LinearStream();
+    recordedCommands->kernelOperation = std::make_unique<KernelOperation>(commandStream, *commandStreamReceiver.getInternalAllocationStorage());
+    auto kernelOperation = recordedCommands->kernelOperation.get();
+
+    MultiDispatchInfo multiDispatchInfo(commandSequence.getDispatch(0).kernel);
+    buildCommandSequenceDispatchInfo(commandSequence, multiDispatchInfo, kernelOperation);
+
+    CsrDependencies csrDeps;
+    auto commandStreamSize = EnqueueOperation<GfxFamily>::getTotalSizeRequiredCS(CL_COMMAND_NDRANGE_KERNEL, csrDeps, false, false, false, *this, multiDispatchInfo) +
+                             sizeof(MI_BATCH_BUFFER_END);
+    commandStreamReceiver.ensureCommandBufferAllocation(*commandStream, commandStreamSize, CSRequirements::csOverfetchSize);
+
+    // same as for blocked enqueues, commands and indirect state land in the kernel operation's own buffers
+    HardwareInterface<GfxFamily>::dispatchWalker(
+        *this,
+        multiDispatchInfo,
+        csrDeps,
+        kernelOperation,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        CL_COMMAND_NDRANGE_KERNEL);
+
+    // executed as a second level batch buffer, returns to the queue's command buffer
+    auto batchBufferEnd = commandStream->getSpaceForCmd<MI_BATCH_BUFFER_END>();
+    *batchBufferEnd = GfxFamily::cmdInitBatchBufferEnd;
+
+    auto ioh = kernelOperation->ioh.get();
+    auto ssh = kernelOperation->ssh.get();
+    for (size_t dispatchIndex = 0; dispatchIndex < commandSequence.getDispatchesCount(); dispatchIndex++) {
+        auto &dispatch = commandSequence.getDispatch(dispatchIndex);
+        if (!dispatch.patchable) {
+            continue;
+        }
+        auto kernel = dispatch.kernel;
+        auto crossThreadDataSize = kernel->getCrossThreadDataSize();
+        auto surfaceStatesSize = CommandSequence::getPatchedSurfaceStatesSize(*kernel);
+        dispatch.patchable = (dispatch.crossThreadDataOffset + crossThreadDataSize <= ioh->getUsed()) &&
+                             (dispatch.surfaceStateOffset + surfaceStatesSize <= ssh->getUsed()) &&
+                             (memcmp(ptrOffset(ioh->getCpuBase(), dispatch.crossThreadDataOffset), kernel->getCrossThreadData(), crossThreadDataSize) == 0) &&
+                             (surfaceStatesSize == 0 || memcmp(ptrOffset(ssh->getCpuBase(), dispatch.surfaceStateOffset), kernel->getSurfaceStateHeap(), surfaceStatesSize) == 0);
+    }
+
+    recordedCommands->commandStreamReceiver = &commandStreamReceiver;
+    recordedCommands->preemptionMode = PreemptionHelper::taskPreemptionMode(getDevice(), multiDispatchInfo);
+    recordedCommands->scratchSize = multiDispatchInfo.getRequiredScratchSize();
+    recordedCommands->privateScratchSize = multiDispatchInfo.getRequiredPrivateScratchSize();
+    recordedCommands->usesSlm = multiDispatchInfo.usesSlm();
+    commandSequence.setRecordedCommands(std::move(recordedCommands));
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::patchRecordedCommandSequence(CommandSequence &commandSequence) {
+    auto recordedCommands = commandSequence.getRecordedCommands();
+    auto ioh = recordedCommands->kernelOperation->ioh.get();
+    auto ssh = recordedCommands->kernelOperation->ssh.get();
+    bool previousReplayCompleted = false;
+
+    for (size_t dispatchIndex = 0; dispatchIndex < commandSequence.getDispatchesCount(); dispatchIndex++) {
+        auto &dispatch = commandSequence.getDispatch(dispatchIndex);
+        if (!dispatch.argsChanged) {
+            continue;
+        }
+        if (!previousReplayCompleted) {
+            getGpgpuCommandStreamReceiver().flushBatchedSubmissions();
+            waitUntilComplete(recordedCommands->taskCount, recordedCommands->flushStamp, false);
+            previousReplayCompleted = true;
+        }
+
+        auto kernel = dispatch.kernel;
+        auto crossThreadDataSize = kernel->getCrossThreadDataSize();
+        memcpy_s(ptrOffset(ioh->getCpuBase(), dispatch.crossThreadDataOffset), crossThreadDataSize, kernel->getCrossThreadData(), crossThreadDataSize);
+        auto surfaceStatesSize = CommandSequence::getPatchedSurfaceStatesSize(*kernel);
+        if (surfaceStatesSize > 0) {
+            memcpy_s(ptrOffset(ssh->getCpuBase(), dispatch.surfaceStateOffset), surfaceStatesSize, kernel->getSurfaceStateHeap(), surfaceStatesSize);
+        }
+        dispatch.argsChanged = false;
+    }
+}
+
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::replayCommandSequence(CommandSequence &commandSequence, cl_event *event) {
+    using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
+
+    auto &commandStreamReceiver = getGpgpuCommandStreamReceiver();
+    auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    if (isQueueBlocked()) {
+        return false;
+    }
+
+    auto recordedCommands = commandSequence.getRecordedCommands();
+    bool recordingRequired = (recordedCommands == nullptr) || (recordedCommands->commandStreamReceiver != &commandStreamReceiver);
+    for (size_t dispatchIndex = 0; dispatchIndex < commandSequence.getDispatchesCount() && !recordingRequired; dispatchIndex++) {
+        auto &dispatch = commandSequence.getDispatch(dispatchIndex);
+        recordingRequired = dispatch.argsChanged && (!dispatch.patchable || dispatch.kernel->slmTotalSize != dispatch.recordedSlmTotalSize);
+    }
+    if (recordingRequired) {
+        recordCommandSequence(commandSequence);
+        recordedCommands = commandSequence.getRecordedCommands();
+    } else {
+        patchRecordedCommandSequence(commandSequence);
+    }
+    auto kernelOperation = recordedCommands->kernelOperation.get();
+
+    EventBuilder eventBuilder;
+    if (event) {
+        eventBuilder.create<Event>(this, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::levelNotReady, 0);
+        *event = eventBuilder.getEvent();
+    }
+
+    auto blockQueue = false;
+    auto taskLevel = 0u;
+    cl_uint numEventsInWaitList = 0;
+    const cl_event *eventWaitList = nullptr;
+    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_NDRANGE_KERNEL);
+    DEBUG_BREAK_IF(blockQueue);
+
+    auto &commandStream = getCS(sizeof(MI_BATCH_BUFFER_START));
+    auto commandStreamStart = commandStream.getUsed();
+    auto batchBufferStart = commandStream.getSpaceForCmd<MI_BATCH_BUFFER_START>();
+    *batchBufferStart = GfxFamily::cmdInitBatchBufferStart;
+    batchBufferStart->setBatchBufferStartAddressGraphicsaddress472(kernelOperation->commandStream->getGraphicsAllocation()->getGpuAddress());
+    batchBufferStart->setAddressSpaceIndicator(MI_BATCH_BUFFER_START::ADDRESS_SPACE_INDICATOR_PPGTT);
+    batchBufferStart->setSecondLevelBatchBuffer(MI_BATCH_BUFFER_START::SECOND_LEVEL_BATCH_BUFFER_SECOND_LEVEL_BATCH);
+    commandStreamReceiver.makeResident(*kernelOperation->commandStream->getGraphicsAllocation());
+
+    auto requiresCoherency = false;
+    auto anyUncacheableArgs = false;
+    auto usePerDssBackedBuffer = false;
+    for (size_t dispatchIndex = 0; dispatchIndex < commandSequence.getDispatchesCount(); dispatchIndex++) {
+        auto kernel = commandSequence.getDispatch(dispatchIndex).kernel;
+        kernel->makeResident(commandStreamReceiver);
+        requiresCoherency |= kernel->requiresCoherency();
+        anyUncacheableArgs |= kernel->hasUncacheableStatelessArgs();
+        usePerDssBackedBuffer |= kernel->requiresPerDssBackedBuffer();
+    }
+    commandStreamReceiver.setRequiredScratchSizes(recordedCommands->scratchSize, recordedCommands->privateScratchSize);
+
+    auto allocNeedsFlushDC = false;
+    if (!device->isFullRangeSvm()) {
+        if (std::any_of(commandStreamReceiver.getResidencyAllocations().begin(), commandStreamReceiver.getResidencyAllocations().end(), [](const auto allocation) { return allocation->isFlushL3Required(); })) {
+            allocNeedsFlushDC = true;
+        }
+    }
+
+    auto mainKernel = commandSequence.getDispatch(0).kernel;
+    DispatchFlags dispatchFlags(
+        {},                                                                                   //csrDependencies
+        nullptr,                                                                              //barrierTimestampPacketNodes
+        {false, mainKernel->isVmeKernel()},                                                   //pipelineSelectArgs
+        this->flushStamp->getStampReference(),                                                //flushStampReference
+        getThrottle(),                                                                        //throttle
+        recordedCommands->preemptionMode,                                                     //preemptionMode
+        mainKernel->getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired,           //numGrfRequired
+        L3CachingSettings::l3CacheOn,                                                         //l3CacheSettings
+        mainKernel->getThreadArbitrationPolicy(),                                             //threadArbitrationPolicy
+        getSliceCount(),                                                                      //sliceCount
+        false,                                                                                //blocking
+        shouldFlushDC(CL_COMMAND_NDRANGE_KERNEL, nullptr) || allocNeedsFlushDC,               //dcFlush
+        recordedCommands->usesSlm,                                                            //useSLM
+        true,                                                                                 //guardCommandBufferWithPipeControl
+        true,                                                                                 //GSBA32BitRequired
+        requiresCoherency,                                                                    //requiresCoherency
+        (QueuePriority::LOW == priority),                                                     //lowPriority
+        false,                                                                                //implicitFlush
+        !eventBuilder.getEvent() || commandStreamReceiver.isNTo1SubmissionModelEnabled(),     //outOfOrderExecutionAllowed
+        false,                                                                                //epilogueRequired
+        usePerDssBackedBuffer                                                                 //usePerDssBackedBuffer
+    );
+
+    dispatchFlags.pipelineSelectArgs.specialPipelineSelectMode = mainKernel->requiresSpecialPipelineSelectMode();
+    if (anyUncacheableArgs) {
+        dispatchFlags.l3CacheSettings = L3CachingSettings::l3CacheOff;
+    } else if (!mainKernel->areStatelessWritesUsed()) {
+        dispatchFlags.l3CacheSettings = L3CachingSettings::l3AndL1On;
+    }
+
+    if (this->dispatchHints != 0) {
+        dispatchFlags.engineHints = this->dispatchHints;
+        dispatchFlags.epilogueRequired = true;
+    }
+
+    DEBUG_BREAK_IF(taskLevel >= CompletionStamp::levelNotReady);
+
+    auto completionStamp = commandStreamReceiver.flushTask(
+        commandStream,
+        commandStreamStart,
+        *kernelOperation->dsh,
+        *kernelOperation->ioh,
+        *kernelOperation->ssh,
+        taskLevel,
+        dispatchFlags,
+        getDevice());
+
+    recordedCommands->taskCount = completionStamp.taskCount;
+    recordedCommands->flushStamp = completionStamp.flushStamp;
+
+    if (eventBuilder.getEvent()) {
+        eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+    }
+    updateFromCompletionStamp(completionStamp);
+    if (eventBuilder.getEvent()) {
+        eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
+    }
+
+    queueOwnership.unlock();
+    commandStreamReceiverOwnership.unlock();
+
+    if (DebugManager.flags.MakeEachEnqueueBlocking.get()) {
+        waitUntilComplete(taskCount, flushStamp->peekStamp(), false);
+    }
+    return true;
+}
 } // namespace NEO
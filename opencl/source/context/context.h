@@ -18,6 +18,7 @@
 namespace NEO {
 
 struct BuiltInKernel;
+class BufferPoolAllocator;
 class CommandStreamReceiver;
 class CommandQueue;
 class Device;
@@ -88,6 +89,10 @@ class Context : public BaseObject<_cl_context> {
         return svmAllocsManager;
     }
 
+    BufferPoolAllocator *getBufferPoolAllocator() const {
+        return smallBufferPoolAllocator.get();
+    }
+
     DeviceQueue *getDefaultDeviceQueue();
     void setDefaultDeviceQueue(DeviceQueue *queue);
 
@@ -159,6 +164,7 @@ class Context : public BaseObject<_cl_context> {
     ClDeviceVector devices;
     MemoryManager *memoryManager;
     SVMAllocsManager *svmAllocsManager = nullptr;
+    std::unique_ptr<BufferPoolAllocator> smallBufferPoolAllocator;
     CommandQueue *specialQueue;
     DeviceQueue *defaultDeviceQueue;
     std::vector<std::unique_ptr<SharingFunctions>> sharingFunctions;
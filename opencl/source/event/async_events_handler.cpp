@@ -7,9 +7,11 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
 #include <iterator>
@@ -20,6 +22,7 @@ AsyncEventsHandler::AsyncEventsHandler() {
     registerList.reserve(64);
     list.reserve(64);
     pendingList.reserve(64);
+    completionWatermarks.reserve(4);
 }
 
 AsyncEventsHandler::~AsyncEventsHandler() {
@@ -40,10 +43,16 @@ Event *AsyncEventsHandler::processList() {
     uint32_t lowestTaskCount = CompletionStamp::levelNotReady;
     Event *sleepCandidate = nullptr;
     pendingList.clear();
+    completionWatermarks.clear();
 
     for (auto event : list) {
-        event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+        // submitted events past their CSR's completion watermark can't change state, skip querying them
+        bool keepPending = isAboveCompletionWatermark(*event);
+        if (!keepPending) {
+            event->updateExecutionStatus();
+            keepPending = event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE));
+        }
+        if (keepPending) {
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -58,6 +67,25 @@ Event *AsyncEventsHandler::processList() {
     return sleepCandidate;
 }
 
+bool AsyncEventsHandler::isAboveCompletionWatermark(Event &event) {
+    auto cmdQueue = event.getCommandQueue();
+    auto taskCount = event.peekTaskCount();
+    if ((cmdQueue == nullptr) || event.isExternallySynchronized() ||
+        (event.peekExecutionStatus() != CL_SUBMITTED) || (taskCount == CompletionStamp::levelNotReady)) {
+        return false;
+    }
+
+    auto csr = &cmdQueue->getGpgpuCommandStreamReceiver();
+    for (auto &watermark : completionWatermarks) {
+        if (watermark.first == csr) {
+            return taskCount > watermark.second;
+        }
+    }
+    auto completedTaskCount = cmdQueue->getHwTag();
+    completionWatermarks.emplace_back(csr, completedTaskCount);
+    return taskCount > completedTaskCount;
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -78,9 +106,16 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
 
         sleepCandidate = self->processList();
         if (sleepCandidate) {
+            // sleep until the lowest pending task count completes, next pass retires everything below the new watermarks
             sleepCandidate->wait(true, true);
+        } else if (!self->list.empty()) {
+            // only blocked events left, nothing to wait on in HW
+            lock.lock();
+            if (self->allowAsyncProcess && self->registerList.empty()) {
+                self->asyncCond.wait_for(lock, self->blockedEventsPollInterval);
+            }
+            lock.unlock();
         }
-        std::this_thread::yield();
     }
     return nullptr;
 }
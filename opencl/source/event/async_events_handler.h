@@ -7,12 +7,15 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -25,6 +28,7 @@ class AsyncEventsHandler {
 
   protected:
     Event *processList();
+    bool isAboveCompletionWatermark(Event &event);
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
@@ -32,6 +36,9 @@ class AsyncEventsHandler {
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    // completed task count of every CSR seen during a single processList() pass
+    std::vector<std::pair<CommandStreamReceiver *, uint32_t>> completionWatermarks;
+    std::chrono::microseconds blockedEventsPollInterval{100};
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
@@ -16,6 +16,7 @@
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/stackvec.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/api/cl_types.h"
@@ -23,6 +24,7 @@
 #include "opencl/source/context/context.h"
 #include "opencl/source/event/async_events_handler.h"
 #include "opencl/source/event/event_tracker.h"
+#include "opencl/source/helpers/cl_helper.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/mem_obj/mem_obj.h"
@@ -322,6 +324,22 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     dataCalculated = true;
 }
 
+void Event::recordTraceSpans() {
+    if (!profilingEnabled || DebugManager.flags.ReturnRawGpuTimestamps.get() || !calcProfilingData()) {
+        return;
+    }
+
+    // profiling timestamps are in OSTime cpu domain, shift them to the trace recorder clock
+    uint64_t cpuTime = 0;
+    cmdQueue->getDevice().getOSTime()->getCpuTime(&cpuTime);
+    auto clockOffset = TraceRecorder::getTimestamp() - cpuTime;
+
+    auto &traceRecorder = TraceRecorder::get();
+    auto commandName = traceRecorder.storeName(cmdTypetoString(cmdType));
+    traceRecorder.recordSpan(TraceCategory::enqueue, commandName, queueTimeStamp.CPUTimeinNS + clockOffset, submitTimeStamp.CPUTimeinNS + clockOffset, taskCount);
+    traceRecorder.recordSpan(TraceCategory::gpu, commandName, startTimeStamp + clockOffset, endTimeStamp + clockOffset, taskCount);
+}
+
 inline bool Event::wait(bool blocking, bool useQuickKmdSleep) {
     while (this->taskCount == CompletionStamp::levelNotReady) {
         if (blocking == false) {
@@ -368,6 +386,9 @@ void Event::updateExecutionStatus() {
 
     if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp()))) {
         transitionExecutionStatus(CL_COMPLETE);
+        if (TraceRecorder::isEnabled()) {
+            recordTraceSpans();
+        }
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
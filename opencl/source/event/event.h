@@ -321,6 +321,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
 
     bool calcProfilingData();
     MOCKABLE_VIRTUAL void calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t contextEndTS, uint64_t *contextCompleteTS, uint64_t globalStartTS);
+    void recordTraceSpans();
     MOCKABLE_VIRTUAL void synchronizeTaskCount() {
         while (this->taskCount == CompletionStamp::levelNotReady)
             ;
@@ -192,6 +192,10 @@ template void Kernel::patchWithImplicitSurface(void *ptrToPatchInCrossThreadData
 cl_int Kernel::initialize() {
     cl_int retVal = CL_OUT_OF_HOST_MEMORY;
     do {
+        if (false == kernelInfo.materializeKernelAllocation()) {
+            return CL_OUT_OF_HOST_MEMORY;
+        }
+
         const auto &workloadInfo = kernelInfo.workloadInfo;
         const auto &heapInfo = kernelInfo.heapInfo;
         const auto &patchInfo = kernelInfo.patchInfo;
@@ -377,6 +381,10 @@ cl_int Kernel::initialize() {
             }
         }
 
+        if (DebugManager.flags.EnableKernelArgPatchPlan.get() != 0) {
+            argPatchPlan = &kernelInfo.obtainArgPatchPlan();
+        }
+
         auxTranslationRequired &= hwHelper.requiresAuxResolves();
 
         if (DebugManager.flags.DisableAuxTranslation.get()) {
@@ -1109,12 +1117,15 @@ void Kernel::makeResident(CommandStreamReceiver &commandStreamReceiver) {
         commandStreamReceiver.makeResident(*(program->getExportedFunctionsSurface()));
     }
 
+    auto pageFaultManager = program->peekExecutionEnvironment().memoryManager->getPageFaultManager();
+
     for (auto gfxAlloc : kernelSvmGfxAllocations) {
         commandStreamReceiver.makeResident(*gfxAlloc);
+        if (pageFaultManager) {
+            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(gfxAlloc->getGpuAddress()));
+        }
     }
 
-    auto pageFaultManager = program->peekExecutionEnvironment().memoryManager->getPageFaultManager();
-
     for (auto gfxAlloc : kernelUnifiedMemoryGfxAllocations) {
         commandStreamReceiver.makeResident(*gfxAlloc);
         if (pageFaultManager) {
@@ -1475,6 +1486,12 @@ cl_int Kernel::setArgImmediate(uint32_t argIndex,
         auto crossThreadData = getCrossThreadData();
         auto crossThreadDataEnd = ptrOffset(crossThreadData, getCrossThreadDataSize());
 
+        if (argPatchPlan && argIndex < argPatchPlan->getArgsCount()) {
+            DEBUG_BREAK_IF(!(ptrOffset(crossThreadData, argPatchPlan->getRequiredCrossThreadDataSize(argIndex)) <= crossThreadDataEnd));
+            argPatchPlan->patchImmediate(argIndex, crossThreadData, argVal, argSize);
+            return CL_SUCCESS;
+        }
+
         for (const auto &kernelArgPatchInfo : kernelArgInfo.kernelArgPatchInfoVector) {
             DEBUG_BREAK_IF(kernelArgPatchInfo.size <= 0);
             auto pDst = ptrOffset(crossThreadData, kernelArgPatchInfo.crossthreadOffset);
@@ -510,6 +510,7 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     std::vector<SimpleKernelArgInfo> kernelArguments;
     std::vector<KernelArgHandler> kernelArgHandlers;
+    const KernelArgPatchPlan *argPatchPlan = nullptr;
     std::vector<GraphicsAllocation *> kernelSvmGfxAllocations;
     std::vector<GraphicsAllocation *> kernelUnifiedMemoryGfxAllocations;
 
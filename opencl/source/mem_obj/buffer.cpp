@@ -22,12 +22,14 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/parallel_memcpy.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/device/cl_device.h"
 #include "opencl/source/helpers/memory_properties_flags_helpers.h"
 #include "opencl/source/helpers/validators.h"
+#include "opencl/source/mem_obj/buffer_pool_allocator.h"
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
 namespace NEO {
@@ -64,7 +66,18 @@ Buffer::Buffer(Context *context,
 Buffer::Buffer() : MemObj(nullptr, CL_MEM_OBJECT_BUFFER, {}, 0, 0, 0, nullptr, nullptr, nullptr, false, false, false) {
 }
 
-Buffer::~Buffer() = default;
+Buffer::~Buffer() {
+    if (isAllocatedFromPool) {
+        // the same as MemObj does for its own allocation, GPU work is completed before destructor callbacks are called
+        bool needWait = !destructorCallbacks.empty() || allocatedMapPtr != nullptr || !DebugManager.flags.EnableAsyncDestroyAllocations.get();
+        if (needWait && graphicsAllocation->isUsed()) {
+            memoryManager->waitForEnginesCompletion(*graphicsAllocation);
+        }
+        context->getBufferPoolAllocator()->freeChunk(graphicsAllocation, offset);
+        // storage is owned by the pool, MemObj must not release it
+        graphicsAllocation = nullptr;
+    }
+}
 
 bool Buffer::isSubBuffer() {
     return this->associatedMemObject != nullptr;
@@ -167,6 +180,15 @@ Buffer *Buffer::create(Context *context,
         return nullptr;
     }
 
+    auto bufferPoolAllocator = context->getBufferPoolAllocator();
+    if (bufferPoolAllocator && bufferPoolAllocator->isSuitableForPooling(memoryProperties, flags, flagsIntel, size, allocationType)) {
+        size_t offsetInPool = 0;
+        auto poolStorage = bufferPoolAllocator->allocateChunk(rootDeviceIndex, size, offsetInPool);
+        if (poolStorage) {
+            return createFromPool(context, memoryProperties, flags, flagsIntel, size, hostPtr, poolStorage, offsetInPool, errcodeRet);
+        }
+    }
+
     if (allocationType == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
         zeroCopyAllowed = false;
         allocateMemory = true;
@@ -331,6 +353,38 @@ Buffer *Buffer::create(Context *context,
     return pBuffer;
 }
 
+Buffer *Buffer::createFromPool(Context *context,
+                               MemoryPropertiesFlags memoryProperties,
+                               cl_mem_flags flags,
+                               cl_mem_flags_intel flagsIntel,
+                               size_t size,
+                               void *hostPtr,
+                               GraphicsAllocation *poolStorage,
+                               size_t offsetInPool,
+                               cl_int &errcodeRet) {
+    auto memoryStorage = ptrOffset(poolStorage->getUnderlyingBuffer(), offsetInPool);
+    auto pBuffer = createBufferHw(context, memoryProperties, flags, flagsIntel, size, memoryStorage, nullptr, poolStorage, true, false, false);
+    if (!pBuffer) {
+        context->getBufferPoolAllocator()->freeChunk(poolStorage, offsetInPool);
+        errcodeRet = CL_OUT_OF_HOST_MEMORY;
+        return nullptr;
+    }
+    // the same way as sub-buffers, pooled buffers address their storage through offset
+    pBuffer->offset = offsetInPool;
+    pBuffer->isAllocatedFromPool = true;
+
+    if (memoryProperties.flags.copyHostPtr) {
+        memcpy_s(memoryStorage, size, hostPtr, size);
+    }
+
+    printDebugString(DebugManager.flags.LogMemoryObject.get(), stdout,
+                     "\nCreated Buffer from pool: Handle %p, size %llu, memoryStorage %p, GPU address %#llx, offset %llu\n",
+                     pBuffer, size, memoryStorage, poolStorage->getGpuAddress(), offsetInPool);
+
+    errcodeRet = CL_SUCCESS;
+    return pBuffer;
+}
+
 Buffer *Buffer::createSharedBuffer(Context *context, cl_mem_flags flags, SharingHandler *sharingHandler,
                                    GraphicsAllocation *graphicsAllocation) {
     auto sharedBuffer = createBufferHw(context, MemoryPropertiesFlagsParser::createMemoryPropertiesFlags(flags, 0, 0), flags, 0, graphicsAllocation->getUnderlyingBufferSize(), nullptr, nullptr, graphicsAllocation, false, false, false);
@@ -430,7 +484,7 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
     }
 
     buffer->associatedMemObject = this;
-    buffer->offset = region->origin;
+    buffer->offset = this->offset + region->origin;
     buffer->setParentSharingHandler(this->getSharingHandler());
     this->incRefInternal();
 
@@ -484,7 +538,7 @@ void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffs
     DBG_LOG(LogMemoryObject, __FUNCTION__, " hostPtr: ", hostPtr, ", size: ", copySize, ", offset: ", copyOffset, ", memoryStorage: ", memoryStorage);
     auto dstPtr = ptrOffset(dst, copyOffset);
     auto srcPtr = ptrOffset(src, copyOffset);
-    memcpy_s(dstPtr, copySize, srcPtr, copySize);
+    parallelMemcpy(dstPtr, copySize, srcPtr, copySize);
 }
 
 void Buffer::transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
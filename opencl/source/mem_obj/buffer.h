@@ -72,6 +72,16 @@ class Buffer : public MemObj {
                           void *hostPtr,
                           cl_int &errcodeRet);
 
+    static Buffer *createFromPool(Context *context,
+                                  MemoryPropertiesFlags memoryProperties,
+                                  cl_mem_flags flags,
+                                  cl_mem_flags_intel flagsIntel,
+                                  size_t size,
+                                  void *hostPtr,
+                                  GraphicsAllocation *poolStorage,
+                                  size_t offsetInPool,
+                                  cl_int &errcodeRet);
+
     static Buffer *createSharedBuffer(Context *context,
                                       cl_mem_flags flags,
                                       SharingHandler *sharingHandler,
@@ -143,6 +153,7 @@ class Buffer : public MemObj {
     uint32_t getMocsValue(bool disableL3Cache, bool isReadOnlyArgument) const;
 
     bool isCompressed() const;
+    bool isPooledBuffer() const { return isAllocatedFromPool; }
 
   protected:
     Buffer(Context *context,
@@ -172,6 +183,8 @@ class Buffer : public MemObj {
     static bool isReadOnlyMemoryPermittedByFlags(const MemoryPropertiesFlags &properties);
 
     void transferData(void *dst, void *src, size_t copySize, size_t copyOffset);
+
+    bool isAllocatedFromPool = false;
 };
 
 template <typename GfxFamily>
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/mem_obj/buffer_pool_allocator.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include "opencl/source/context/context.h"
+#include "opencl/source/device/cl_device.h"
+#include "opencl/source/helpers/mem_properties_parser_helper.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+constexpr size_t BufferPoolAllocator::poolSize;
+constexpr size_t BufferPoolAllocator::defaultMaxBufferSize;
+constexpr size_t BufferPoolAllocator::maxIdlePoolsCount;
+
+BufferPoolAllocator::BufferPoolAllocator(Context &context) : context(context) {
+    memoryManager = context.getMemoryManager();
+    for (size_t deviceOrdinal = 0; deviceOrdinal < context.getNumDevices(); deviceOrdinal++) {
+        auto device = context.getDevice(deviceOrdinal);
+        chunkAlignment = std::max(chunkAlignment, static_cast<size_t>(device->getDeviceInfo().memBaseAddressAlign / 8));
+    }
+
+    if (DebugManager.flags.SmallBufferPoolMaxBufferSize.get() != -1) {
+        maxBufferSize = static_cast<size_t>(DebugManager.flags.SmallBufferPoolMaxBufferSize.get());
+    }
+    maxBufferSize = std::min(maxBufferSize, poolSize);
+}
+
+BufferPoolAllocator::~BufferPoolAllocator() {
+    for (auto &pool : bufferPools) {
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(pool.mainStorage);
+    }
+}
+
+bool BufferPoolAllocator::isAggregationEnabled() {
+    return DebugManager.flags.EnableSmallBufferPool.get() == 1;
+}
+
+bool BufferPoolAllocator::isSuitableForPooling(const MemoryPropertiesFlags &memoryProperties, cl_mem_flags flags, cl_mem_flags_intel flagsIntel,
+                                               size_t size, GraphicsAllocation::AllocationType allocationType) const {
+    constexpr cl_mem_flags supportedFlags = CL_MEM_READ_WRITE | CL_MEM_WRITE_ONLY | CL_MEM_READ_ONLY |
+                                            CL_MEM_ALLOC_HOST_PTR | CL_MEM_COPY_HOST_PTR |
+                                            CL_MEM_HOST_WRITE_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_NO_ACCESS;
+
+    if (size > maxBufferSize || (flags & ~supportedFlags) != 0 || flagsIntel != 0) {
+        return false;
+    }
+    if (memoryProperties.flags.useHostPtr || memoryProperties.flags.forceSharedPhysicalMemory || context.isSharedContext) {
+        return false;
+    }
+    // pool storage is zero copy system memory, so compressed or non zero copy buffers can't be placed there
+    if (allocationType == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED || DebugManager.flags.DisableZeroCopyForBuffers.get()) {
+        return false;
+    }
+    return true;
+}
+
+GraphicsAllocation *BufferPoolAllocator::allocateChunk(uint32_t rootDeviceIndex, size_t size, size_t &outOffset) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    for (auto &pool : bufferPools) {
+        if (pool.rootDeviceIndex != rootDeviceIndex) {
+            continue;
+        }
+        auto chunkAddress = allocateChunkFromPool(pool, size);
+        if (chunkAddress == 0u && releaseCompletedChunks(pool)) {
+            chunkAddress = allocateChunkFromPool(pool, size);
+        }
+        if (chunkAddress != 0u) {
+            outOffset = static_cast<size_t>(chunkAddress - pool.mainStorage->getGpuAddress());
+            return pool.mainStorage;
+        }
+    }
+
+    if (!addNewBufferPool(rootDeviceIndex)) {
+        return nullptr;
+    }
+    auto &pool = *bufferPools.rbegin();
+    auto chunkAddress = allocateChunkFromPool(pool, size);
+    UNRECOVERABLE_IF(chunkAddress == 0u);
+    outOffset = static_cast<size_t>(chunkAddress - pool.mainStorage->getGpuAddress());
+    return pool.mainStorage;
+}
+
+void BufferPoolAllocator::freeChunk(GraphicsAllocation *poolStorage, size_t offset) {
+    // work using the chunk was submitted before it is released, so it is covered by current task counts of pool storage
+    ChunkToFree chunkToFree;
+    if (poolStorage->isUsed()) {
+        for (auto &engine : memoryManager->getRegisteredEnginesSnapshot()) {
+            auto osContextId = engine.osContext->getContextId();
+            auto taskCount = poolStorage->getTaskCount(osContextId);
+            if (poolStorage->isUsedByOsContext(osContextId) && taskCount > *engine.commandStreamReceiver->getTagAddress()) {
+                chunkToFree.pendingTaskCounts.push_back({engine.commandStreamReceiver, taskCount});
+            }
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    auto pool = std::find_if(bufferPools.begin(), bufferPools.end(), [&](const BufferPool &pool) { return pool.mainStorage == poolStorage; });
+    if (pool == bufferPools.end()) {
+        DEBUG_BREAK_IF(true);
+        return;
+    }
+    auto chunk = pool->allocatedChunks.find(poolStorage->getGpuAddress() + offset);
+    UNRECOVERABLE_IF(chunk == pool->allocatedChunks.end());
+    chunkToFree.ptr = chunk->first;
+    chunkToFree.size = chunk->second;
+    pool->chunksToFree.push_back(std::move(chunkToFree));
+    pool->allocatedChunks.erase(chunk);
+
+    // pools only grow when chunks are allocated, so pools left unused above the limit are released here
+    if (!pool->allocatedChunks.empty() || getIdlePoolsCount(pool->rootDeviceIndex) <= maxIdlePoolsCount) {
+        return;
+    }
+    bufferPools.erase(pool);
+    lock.unlock();
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(poolStorage);
+}
+
+size_t BufferPoolAllocator::getIdlePoolsCount(uint32_t rootDeviceIndex) const {
+    return static_cast<size_t>(std::count_if(bufferPools.begin(), bufferPools.end(), [&](const BufferPool &pool) {
+        return pool.rootDeviceIndex == rootDeviceIndex && pool.allocatedChunks.empty();
+    }));
+}
+
+uint64_t BufferPoolAllocator::allocateChunkFromPool(BufferPool &pool, size_t size) {
+    size_t chunkSize = size;
+    auto chunkAddress = pool.chunkAllocator->allocate(chunkSize);
+    if (chunkAddress != 0u) {
+        pool.allocatedChunks[chunkAddress] = chunkSize;
+    }
+    return chunkAddress;
+}
+
+bool BufferPoolAllocator::releaseCompletedChunks(BufferPool &pool) {
+    // chunks still used by GPU are left for later, a new pool is added rather than waiting for them
+    auto isCompleted = [](const ChunkToFree &chunk) {
+        for (auto &pendingTaskCount : chunk.pendingTaskCounts) {
+            if (*pendingTaskCount.first->getTagAddress() < pendingTaskCount.second) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    bool released = false;
+    for (auto chunk = pool.chunksToFree.begin(); chunk != pool.chunksToFree.end();) {
+        if (isCompleted(*chunk)) {
+            pool.chunkAllocator->free(chunk->ptr, chunk->size);
+            chunk = pool.chunksToFree.erase(chunk);
+            released = true;
+        } else {
+            ++chunk;
+        }
+    }
+    return released;
+}
+
+bool BufferPoolAllocator::addNewBufferPool(uint32_t rootDeviceIndex) {
+    auto allocationProperties = MemoryPropertiesParser::getAllocationProperties(rootDeviceIndex, {}, true, poolSize,
+                                                                                GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY,
+                                                                                context.areMultiStorageAllocationsPreferred());
+    auto mainStorage = memoryManager->allocateGraphicsMemoryWithProperties(allocationProperties);
+    if (!mainStorage) {
+        return false;
+    }
+    if (!MemoryPool::isSystemMemoryPool(mainStorage->getMemoryPool())) {
+        memoryManager->freeGraphicsMemory(mainStorage);
+        return false;
+    }
+    mainStorage->setMemObjectsAllocationWithWritableFlags(true);
+
+    BufferPool pool;
+    pool.rootDeviceIndex = rootDeviceIndex;
+    pool.mainStorage = mainStorage;
+    pool.chunkAllocator = std::make_unique<HeapAllocator>(mainStorage->getGpuAddress(), poolSize, chunkAlignment, maxBufferSize);
+    bufferPools.push_back(std::move(pool));
+    return true;
+}
+} // namespace NEO
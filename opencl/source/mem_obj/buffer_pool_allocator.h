@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_constants.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include "opencl/extensions/public/cl_ext_private.h"
+
+#include "CL/cl.h"
+#include "memory_properties_flags.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Context;
+class MemoryManager;
+
+// Suballocates small buffers of a context out of shared system memory allocations,
+// so that they don't need separate allocations (and separate residency) each.
+// Pools are kept per root device. A chunk released by a buffer is reused only after
+// GPU completes work which used the pool storage before the chunk was released.
+// Pools without any allocated chunk above maxIdlePoolsCount per root device are released.
+class BufferPoolAllocator {
+  public:
+    static constexpr size_t poolSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t defaultMaxBufferSize = 64 * MemoryConstants::kiloByte;
+    static constexpr size_t maxIdlePoolsCount = 1u;
+
+    BufferPoolAllocator(Context &context);
+    ~BufferPoolAllocator();
+
+    static bool isAggregationEnabled();
+
+    bool isSuitableForPooling(const MemoryPropertiesFlags &memoryProperties, cl_mem_flags flags, cl_mem_flags_intel flagsIntel,
+                              size_t size, GraphicsAllocation::AllocationType allocationType) const;
+    GraphicsAllocation *allocateChunk(uint32_t rootDeviceIndex, size_t size, size_t &outOffset);
+    void freeChunk(GraphicsAllocation *poolStorage, size_t offset);
+
+    size_t getPoolsCount() const { return bufferPools.size(); }
+    size_t getMaxBufferSize() const { return maxBufferSize; }
+
+  protected:
+    using PendingTaskCounts = StackVec<std::pair<CommandStreamReceiver *, uint32_t>, 4>;
+
+    struct ChunkToFree {
+        uint64_t ptr = 0u;
+        size_t size = 0u;
+        // task counts of pool storage not yet completed when chunk was released
+        PendingTaskCounts pendingTaskCounts;
+    };
+
+    struct BufferPool {
+        uint32_t rootDeviceIndex = 0u;
+        GraphicsAllocation *mainStorage = nullptr;
+        std::unique_ptr<HeapAllocator> chunkAllocator;
+        // freed chunk may be bigger than requested size, so actual sizes are kept until chunk is released
+        std::unordered_map<uint64_t, size_t> allocatedChunks;
+        std::vector<ChunkToFree> chunksToFree;
+    };
+
+    uint64_t allocateChunkFromPool(BufferPool &pool, size_t size);
+    bool releaseCompletedChunks(BufferPool &pool);
+    bool addNewBufferPool(uint32_t rootDeviceIndex);
+    size_t getIdlePoolsCount(uint32_t rootDeviceIndex) const;
+
+    Context &context;
+    MemoryManager *memoryManager = nullptr;
+    size_t maxBufferSize = defaultMaxBufferSize;
+    size_t chunkAlignment = MemoryConstants::cacheLineSize;
+    std::vector<BufferPool> bufferPools;
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -19,6 +19,8 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/compiler_support.h"
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/source/utilities/parallel_memcpy.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
@@ -97,18 +99,24 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
-    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
+    size_t rowsCount = copyRegion[1] * copyRegion[2];
+    size_t rowsPerJob = std::max(ParallelMemcpy::chunkSize / std::max(lineWidth, static_cast<size_t>(1U)), static_cast<size_t>(1U));
+    size_t jobsCount = (rowsCount + rowsPerJob - 1) / rowsPerJob;
+    size_t workersCount = ParallelMemcpy::isParallelCopyPreferred(lineWidth * rowsCount) ? ParallelMemcpy::getWorkersCount(lineWidth * rowsCount) : 1U;
 
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
+    parallelFor(jobsCount, workersCount, [&](size_t jobId) {
+        auto lastRow = std::min((jobId + 1) * rowsPerJob, rowsCount);
+        for (size_t row = jobId * rowsPerJob; row < lastRow; row++) {
+            size_t slice = copyOrigin[2] + row / copyRegion[1];
+            size_t height = copyOrigin[1] + row % copyRegion[1];
+
+            auto srcRowOffset = ptrOffset(src, srcSlicePitch * slice + srcRowPitch * height);
+            auto dstRowOffset = ptrOffset(dest, destSlicePitch * slice + destRowPitch * height);
 
             memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
                      ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
         }
-    }
+    });
 }
 
 Image::~Image() = default;
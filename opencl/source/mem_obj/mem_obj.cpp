@@ -124,6 +124,11 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
     cl_uint refCnt = 0;
     cl_uint mapCount = 0;
     cl_mem clAssociatedMemObject = static_cast<cl_mem>(this->associatedMemObject);
+    size_t clOffset = this->offset;
+    if (memObjectType == CL_MEM_OBJECT_BUFFER) {
+        // pooled buffers have offset within their pool storage, which is not exposed to application
+        clOffset = this->associatedMemObject ? this->offset - this->associatedMemObject->getOffset() : 0u;
+    }
     cl_context ctx = nullptr;
     uint64_t internalHandle = 0llu;
 
@@ -161,8 +166,8 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
         break;
 
     case CL_MEM_OFFSET:
-        srcParamSize = sizeof(offset);
-        srcParam = &offset;
+        srcParamSize = sizeof(clOffset);
+        srcParam = &clOffset;
         break;
 
     case CL_MEM_ASSOCIATED_MEMOBJECT:
@@ -10,6 +10,7 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/context/context.h"
 
 namespace NEO {
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
@@ -17,6 +18,11 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
     auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, ptr, size, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
 }
+void PageFaultManager::transferChunkToCpu(void *ptr, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_READ, ptr, size, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+}
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
     auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
@@ -24,4 +30,28 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     retVal = commandQueue->finish();
     UNRECOVERABLE_IF(retVal);
 }
+void PageFaultManager::transferChunksToGpu(const std::vector<void *> &cleanChunkPtrs, const std::vector<void *> &dirtyChunkPtrs, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    for (auto chunkPtr : cleanChunkPtrs) {
+        auto retVal = commandQueue->enqueueSVMUnmap(chunkPtr, 0, nullptr, nullptr, false);
+        UNRECOVERABLE_IF(retVal);
+    }
+    if (!dirtyChunkPtrs.empty()) {
+        // Chunks are mapped for read on first access, written ones are remapped for write so unmap copies them back.
+        auto svmAllocsManager = commandQueue->getContext().getSVMAllocsManager();
+        for (auto chunkPtr : dirtyChunkPtrs) {
+            auto svmOperation = svmAllocsManager->getSvmMapOperation(chunkPtr);
+            if (svmOperation && svmOperation->readOnlyMap) {
+                auto writeMapOperation = *svmOperation;
+                svmAllocsManager->removeSvmMapOperation(chunkPtr);
+                svmAllocsManager->insertSvmMapOperation(writeMapOperation.regionSvmPtr, writeMapOperation.regionSize,
+                                                        writeMapOperation.baseSvmPtr, writeMapOperation.offset, false);
+            }
+            auto retVal = commandQueue->enqueueSVMUnmap(chunkPtr, 0, nullptr, nullptr, false);
+            UNRECOVERABLE_IF(retVal);
+        }
+    }
+    auto retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+}
 } // namespace NEO
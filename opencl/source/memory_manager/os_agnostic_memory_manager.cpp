@@ -54,10 +54,14 @@ GraphicsAllocation *OsAgnosticMemoryManager::allocateGraphicsMemoryWithAlignment
         counter++;
         return memoryAllocation;
     }
-    auto ptr = allocateSystemMemory(sizeAligned, allocationData.alignment ? alignUp(allocationData.alignment, MemoryConstants::pageSize) : MemoryConstants::pageSize);
+    auto alignment = allocationData.alignment ? alignUp(allocationData.alignment, MemoryConstants::pageSize) : MemoryConstants::pageSize;
+    auto useHugePages = isHugePageAllocationPreferred(sizeAligned);
+    auto ptr = useHugePages ? allocateHugePageSystemMemory(alignUp(sizeAligned, MemoryConstants::pageSize2Mb), alignment)
+                            : allocateSystemMemory(sizeAligned, alignment);
     if (ptr != nullptr) {
+        auto memoryPool = useHugePages ? MemoryPool::System2MBPages : MemoryPool::System4KBPages;
         memoryAllocation = createMemoryAllocation(allocationData.type, ptr, ptr, reinterpret_cast<uint64_t>(ptr), allocationData.size,
-                                                  counter, MemoryPool::System4KBPages, allocationData.rootDeviceIndex, allocationData.flags.uncacheable, allocationData.flags.flushL3, false);
+                                                  counter, memoryPool, allocationData.rootDeviceIndex, allocationData.flags.uncacheable, allocationData.flags.flushL3, false);
 
         if (allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU) {
             //add 2MB padding in case mapPtr is not 2MB aligned
@@ -96,7 +100,7 @@ GraphicsAllocation *OsAgnosticMemoryManager::allocateGraphicsMemory64kb(const Al
     allocationData64kb.size = alignUp(allocationData.size, MemoryConstants::pageSize64k);
     allocationData64kb.alignment = MemoryConstants::pageSize64k;
     auto memoryAllocation = allocateGraphicsMemoryWithAlignment(allocationData64kb);
-    if (memoryAllocation) {
+    if (memoryAllocation && memoryAllocation->getMemoryPool() != MemoryPool::System2MBPages) {
         static_cast<MemoryAllocation *>(memoryAllocation)->overrideMemoryPool(MemoryPool::System64KBPages);
     }
     return memoryAllocation;
@@ -20,7 +20,10 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/source/utilities/runtime_counters.h"
 
+#include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/api/api.h"
 #include "opencl/source/device/cl_device.h"
 #include "opencl/source/event/async_events_handler.h"
@@ -80,6 +83,8 @@ cl_int Platform::getInfo(cl_platform_info paramName,
     const std::string *param = nullptr;
     size_t paramSize = 0;
     uint64_t pVal = 0;
+    uint64_t runtimeCounters[RuntimeCounters::valuesCount];
+    std::string runtimeCounterNames;
 
     switch (paramName) {
     case CL_PLATFORM_HOST_TIMER_RESOLUTION:
@@ -105,6 +110,14 @@ cl_int Platform::getInfo(cl_platform_info paramName,
     case CL_PLATFORM_ICD_SUFFIX_KHR:
         param = &platformInfo->icdSuffixKhr;
         break;
+    case CL_PLATFORM_RUNTIME_COUNTERS_INTEL:
+        paramSize = RuntimeCounters::getValues(runtimeCounters, RuntimeCounters::valuesCount) * sizeof(uint64_t);
+        retVal = changeGetInfoStatusToCLResultType(::getInfo(paramValue, paramValueSize, runtimeCounters, paramSize));
+        break;
+    case CL_PLATFORM_RUNTIME_COUNTER_NAMES_INTEL:
+        runtimeCounterNames = RuntimeCounters::getNames();
+        param = &runtimeCounterNames;
+        break;
     default:
         break;
     }
@@ -164,12 +177,23 @@ bool Platform::initialize(std::vector<std::unique_ptr<Device>> devices) {
         }
     }
 
-    for (auto &clDevice : clDevices) {
+    // ClDevice caps share process wide state and are initialized serially above,
+    // SIP kernels are built by compiler interfaces of their own root devices, so only they are initialized in parallel
+    size_t workersCount = 1u;
+    if (DebugManager.flags.EnableParallelPlatformInitialization.get() != 0 && !executionEnvironment.debugger) {
+        workersCount = std::min(clDevices.size(), getDefaultWorkersCount());
+    }
+    parallelFor(clDevices.size(), workersCount, [&](size_t deviceIndex) {
+        auto clDevice = this->clDevices[deviceIndex];
         auto hwInfo = clDevice->getHardwareInfo();
         if (clDevice->getPreemptionMode() == PreemptionMode::MidThread || clDevice->isDebuggerActive()) {
             auto sipType = SipKernel::getSipKernelType(hwInfo.platform.eRenderCoreFamily, clDevice->isDebuggerActive());
             initSipKernel(sipType, clDevice->getDevice());
         }
+    });
+
+    if (DebugManager.flags.DumpRuntimeCounters.get() == 1) {
+        RuntimeCounters::registerDumpAtExit(DebugManager.flags.RuntimeCountersOutputFile.get());
     }
 
     this->fillGlobalDispatchTable();
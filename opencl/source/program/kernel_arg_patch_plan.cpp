@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/program/kernel_arg_patch_plan.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+void KernelArgPatchPlan::build(const std::vector<KernelArgInfo> &kernelArgInfo) {
+    operations.clear();
+    args.clear();
+    args.resize(kernelArgInfo.size());
+
+    for (size_t argIndex = 0; argIndex < kernelArgInfo.size(); argIndex++) {
+        auto &arg = args[argIndex];
+        arg.firstOperation = static_cast<uint32_t>(operations.size());
+
+        for (const auto &kernelArgPatchInfo : kernelArgInfo[argIndex].kernelArgPatchInfoVector) {
+            if (kernelArgPatchInfo.size == 0) {
+                continue;
+            }
+            arg.requiredSourceSize = std::max(arg.requiredSourceSize, kernelArgPatchInfo.sourceOffset + kernelArgPatchInfo.size);
+            arg.requiredCrossThreadDataSize = std::max(arg.requiredCrossThreadDataSize, kernelArgPatchInfo.crossthreadOffset + kernelArgPatchInfo.size);
+
+            if (arg.operationsCount > 0) {
+                auto &previous = operations.back();
+                if (previous.crossThreadOffset + previous.size == kernelArgPatchInfo.crossthreadOffset &&
+                    previous.sourceOffset + previous.size == kernelArgPatchInfo.sourceOffset) {
+                    previous.size += kernelArgPatchInfo.size;
+                    continue;
+                }
+            }
+
+            KernelArgPatchOperation operation;
+            operation.crossThreadOffset = kernelArgPatchInfo.crossthreadOffset;
+            operation.size = kernelArgPatchInfo.size;
+            operation.sourceOffset = kernelArgPatchInfo.sourceOffset;
+            operations.push_back(operation);
+            arg.operationsCount++;
+        }
+    }
+    built = true;
+}
+} // namespace NEO
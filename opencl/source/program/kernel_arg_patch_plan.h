@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/arrayref.h"
+
+#include "opencl/source/program/kernel_arg_info.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace NEO {
+
+struct KernelArgPatchOperation {
+    uint32_t crossThreadOffset = 0;
+    uint32_t size = 0;
+    uint32_t sourceOffset = 0;
+};
+
+// Flat list of cross thread data copy operations compiled once per KernelInfo from kernelArgPatchInfoVector.
+// Operations of a single argument that are contiguous both in source and in cross thread data are merged,
+// so setting a vector or struct argument usually ends up as a single memcpy.
+class KernelArgPatchPlan {
+  public:
+    void build(const std::vector<KernelArgInfo> &kernelArgInfo);
+
+    bool isBuilt() const { return built; }
+    size_t getArgsCount() const { return args.size(); }
+    ArrayRef<const KernelArgPatchOperation> getOperations(uint32_t argIndex) const {
+        const auto &arg = args[argIndex];
+        return ArrayRef<const KernelArgPatchOperation>(operations.data() + arg.firstOperation, arg.operationsCount);
+    }
+    uint32_t getRequiredSourceSize(uint32_t argIndex) const { return args[argIndex].requiredSourceSize; }
+    uint32_t getRequiredCrossThreadDataSize(uint32_t argIndex) const { return args[argIndex].requiredCrossThreadDataSize; }
+
+    void patchImmediate(uint32_t argIndex, void *crossThreadData, const void *argVal, size_t argSize) const {
+        const auto &arg = args[argIndex];
+        auto operation = operations.data() + arg.firstOperation;
+        auto operationsEnd = operation + arg.operationsCount;
+        auto dst = static_cast<uint8_t *>(crossThreadData);
+        auto src = static_cast<const uint8_t *>(argVal);
+
+        if (argSize >= arg.requiredSourceSize) {
+            for (; operation != operationsEnd; ++operation) {
+                memcpy(dst + operation->crossThreadOffset, src + operation->sourceOffset, operation->size);
+            }
+            return;
+        }
+
+        for (; operation != operationsEnd; ++operation) {
+            if (operation->sourceOffset < argSize) {
+                auto bytesToCopy = std::min(static_cast<size_t>(operation->size), argSize - operation->sourceOffset);
+                memcpy(dst + operation->crossThreadOffset, src + operation->sourceOffset, bytesToCopy);
+            }
+        }
+    }
+
+  protected:
+    struct ArgOperations {
+        uint32_t firstOperation = 0;
+        uint32_t operationsCount = 0;
+        uint32_t requiredSourceSize = 0;
+        uint32_t requiredCrossThreadDataSize = 0;
+    };
+
+    std::vector<KernelArgPatchOperation> operations;
+    std::vector<ArgOperations> args;
+    bool built = false;
+};
+} // namespace NEO
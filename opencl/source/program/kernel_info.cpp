@@ -419,6 +419,10 @@ uint32_t KernelInfo::getConstantBufferSize() const {
 }
 
 bool KernelInfo::createKernelAllocation(uint32_t rootDeviceIndex, MemoryManager *memoryManager) {
+    return allocateKernelIsa(rootDeviceIndex, memoryManager);
+}
+
+bool KernelInfo::allocateKernelIsa(uint32_t rootDeviceIndex, MemoryManager *memoryManager) const {
     UNRECOVERABLE_IF(kernelAllocation);
     auto kernelIsaSize = heapInfo.pKernelHeader->KernelHeapSize;
     kernelAllocation = memoryManager->allocateGraphicsMemoryWithProperties({rootDeviceIndex, kernelIsaSize, GraphicsAllocation::AllocationType::KERNEL_ISA});
@@ -428,6 +432,44 @@ bool KernelInfo::createKernelAllocation(uint32_t rootDeviceIndex, MemoryManager
     return memoryManager->copyMemoryToAllocation(kernelAllocation, heapInfo.pKernelHeap, kernelIsaSize);
 }
 
+void KernelInfo::deferKernelAllocation(uint32_t rootDeviceIndex, MemoryManager *memoryManager) {
+    std::lock_guard<std::mutex> lock(kernelAllocationMutex);
+    UNRECOVERABLE_IF(kernelAllocation);
+    deferredKernelAllocation.memoryManager = memoryManager;
+    deferredKernelAllocation.rootDeviceIndex = rootDeviceIndex;
+}
+
+bool KernelInfo::materializeKernelAllocation() const {
+    // threads creating kernels concurrently block on the mutex while the ISA is allocated and copied
+    std::lock_guard<std::mutex> lock(kernelAllocationMutex);
+    auto memoryManager = deferredKernelAllocation.memoryManager;
+    if (nullptr == memoryManager) {
+        return true;
+    }
+    if (false == allocateKernelIsa(deferredKernelAllocation.rootDeviceIndex, memoryManager)) {
+        if (kernelAllocation) {
+            memoryManager->freeGraphicsMemory(kernelAllocation);
+            kernelAllocation = nullptr;
+        }
+        return false;
+    }
+    deferredKernelAllocation.memoryManager = nullptr;
+    return true;
+}
+
+bool KernelInfo::isKernelAllocationDeferred() const {
+    std::lock_guard<std::mutex> lock(kernelAllocationMutex);
+    return nullptr != deferredKernelAllocation.memoryManager;
+}
+
+const KernelArgPatchPlan &KernelInfo::obtainArgPatchPlan() const {
+    std::lock_guard<std::mutex> lock(argPatchPlanMutex);
+    if (false == argPatchPlan.isBuilt()) {
+        argPatchPlan.build(kernelArgInfo);
+    }
+    return argPatchPlan;
+}
+
 void KernelInfo::apply(const DeviceInfoKernelPayloadConstants &constants) {
     if (nullptr == this->crossThreadData) {
         return;
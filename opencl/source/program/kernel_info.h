@@ -13,6 +13,7 @@
 
 #include "opencl/source/program/heap_info.h"
 #include "opencl/source/program/kernel_arg_info.h"
+#include "opencl/source/program/kernel_arg_patch_plan.h"
 
 #include "patch_info.h"
 
@@ -21,6 +22,7 @@
 #include <cmath>
 #include <cstdint>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -185,6 +187,10 @@ struct KernelInfo {
     }
 
     bool createKernelAllocation(uint32_t rootDeviceIndex, MemoryManager *memoryManager);
+    void deferKernelAllocation(uint32_t rootDeviceIndex, MemoryManager *memoryManager);
+    bool materializeKernelAllocation() const;
+    bool isKernelAllocationDeferred() const;
+    const KernelArgPatchPlan &obtainArgPatchPlan() const;
     void apply(const DeviceInfoKernelPayloadConstants &constants);
 
     std::string name;
@@ -210,12 +216,24 @@ struct KernelInfo {
     uint32_t systemKernelOffset = 0;
     uint64_t kernelId = 0;
     bool isKernelHeapSubstituted = false;
-    GraphicsAllocation *kernelAllocation = nullptr;
+    // created on first use when kernel ISA allocation is deferred
+    mutable GraphicsAllocation *kernelAllocation = nullptr;
+    mutable struct {
+        MemoryManager *memoryManager = nullptr;
+        uint32_t rootDeviceIndex = 0U;
+    } deferredKernelAllocation;
+    mutable std::mutex kernelAllocationMutex;
+    // built on first use from kernelArgInfo
+    mutable KernelArgPatchPlan argPatchPlan;
+    mutable std::mutex argPatchPlanMutex;
     DebugData debugData;
     bool computeMode = false;
     const gtpin::igc_info_t *igcInfoForGtpin = nullptr;
 
     KernelDescriptor kernelDescriptor;
+
+  protected:
+    bool allocateKernelIsa(uint32_t rootDeviceIndex, MemoryManager *memoryManager) const;
 };
 
 std::string concatenateKernelNames(ArrayRef<KernelInfo *> kernelInfos);
@@ -187,10 +187,16 @@ cl_int Program::processProgramInfo(ProgramInfo &src) {
 
     this->globalVarTotalSize = src.globalVariables.size;
 
+    this->kernelIsaAllocationsDeferred = isLazyKernelIsaAllocationAllowed();
+
     for (auto &kernelInfo : this->kernelInfoArray) {
         cl_int retVal = CL_SUCCESS;
         if (kernelInfo->heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
-            retVal = kernelInfo->createKernelAllocation(this->pDevice->getRootDeviceIndex(), this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            if (this->kernelIsaAllocationsDeferred) {
+                kernelInfo->deferKernelAllocation(this->pDevice->getRootDeviceIndex(), this->pDevice->getMemoryManager());
+            } else {
+                retVal = kernelInfo->createKernelAllocation(this->pDevice->getRootDeviceIndex(), this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            }
         }
 
         DEBUG_BREAK_IF(kernelInfo->heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
@@ -211,6 +217,32 @@ cl_int Program::processProgramInfo(ProgramInfo &src) {
     return linkBinary();
 }
 
+bool Program::isLazyKernelIsaAllocationAllowed() const {
+    if (DebugManager.flags.EnableLazyKernelIsaAllocation.get() != 1) {
+        return false;
+    }
+    // ISA of linked programs, block kernels and debugged kernels is referenced before any kernel gets created
+    if ((nullptr != linkerInput) || kernelDebugEnabled) {
+        return false;
+    }
+    for (const auto &kernelInfo : kernelInfoArray) {
+        if (kernelInfo->hasDeviceEnqueue()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t Program::getNumKernelsWithDeferredIsa() const {
+    uint32_t numDeferred = 0U;
+    for (const auto &kernelInfo : kernelInfoArray) {
+        if (kernelInfo->isKernelAllocationDeferred()) {
+            ++numDeferred;
+        }
+    }
+    return numDeferred;
+}
+
 void Program::processDebugData() {
     if (debugData != nullptr) {
         SProgramDebugDataHeaderIGC *programDebugHeader = reinterpret_cast<SProgramDebugDataHeaderIGC *>(debugData.get());
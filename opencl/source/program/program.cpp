@@ -390,10 +390,16 @@ void Program::freeBlockResources() {
 }
 
 void Program::cleanCurrentKernelInfo() {
+    if (kernelIsaAllocationsDeferred) {
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr,
+                         "Lazy kernel ISA allocation: %u of %zu kernels were never materialized\n",
+                         getNumKernelsWithDeferredIsa(), kernelInfoArray.size());
+        kernelIsaAllocationsDeferred = false;
+    }
     for (auto &kernelInfo : kernelInfoArray) {
         if (kernelInfo->kernelAllocation) {
             //register cache flush in all csrs where kernel allocation was used
-            for (auto &engine : this->executionEnvironment.memoryManager->getRegisteredEngines()) {
+            for (auto &engine : this->executionEnvironment.memoryManager->getRegisteredEnginesSnapshot()) {
                 auto contextId = engine.osContext->getContextId();
                 if (kernelInfo->kernelAllocation->isUsedByOsContext(contextId)) {
                     engine.commandStreamReceiver->registerInstructionCacheFlush();
@@ -152,6 +152,7 @@ class Program : public BaseObject<_cl_program> {
     size_t getNumKernels() const;
     const KernelInfo *getKernelInfo(const char *kernelName) const;
     const KernelInfo *getKernelInfo(size_t ordinal) const;
+    uint32_t getNumKernelsWithDeferredIsa() const;
 
     cl_int getInfo(cl_program_info paramName, size_t paramValueSize,
                    void *paramValue, size_t *paramValueSizeRet);
@@ -269,6 +270,8 @@ class Program : public BaseObject<_cl_program> {
 
     MOCKABLE_VIRTUAL cl_int linkBinary();
 
+    bool isLazyKernelIsaAllocationAllowed() const;
+
     void separateBlockKernels();
 
     void updateNonUniformFlag();
@@ -340,6 +343,7 @@ class Program : public BaseObject<_cl_program> {
 
     bool isBuiltIn = false;
     bool kernelDebugEnabled = false;
+    bool kernelIsaAllocationsDeferred = false;
 };
 
 } // namespace NEO
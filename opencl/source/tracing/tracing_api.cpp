@@ -7,6 +7,7 @@
 
 #include "opencl/source/tracing/tracing_api.h"
 
+#include "opencl/source/tracing/tracing_collector.h"
 #include "opencl/source/tracing/tracing_handle.h"
 #include "opencl/source/tracing/tracing_notify.h"
 
@@ -137,11 +138,19 @@ cl_int CL_API_CALL clEnableTracingINTEL(cl_tracing_handle handle) {
     }
 
     tracingHandle.push_back(handle->handle);
+    bool startCollector = false;
     if (tracingHandle.size() == 1) {
+        if (isDeferredTracingRequested()) {
+            deferredTracingEnabled.store(true, std::memory_order_release);
+            startCollector = true;
+        }
         tracingState.fetch_or(TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
     }
 
     UnlockTracingState();
+    if (startCollector) {
+        startDeferredTracing();
+    }
     return CL_SUCCESS;
 }
 
@@ -150,19 +159,27 @@ cl_int CL_API_CALL clDisableTracingINTEL(cl_tracing_handle handle) {
         return CL_INVALID_VALUE;
     }
 
+    // records buffered so far are delivered while the handle is still registered
+    deliverDeferredRecords();
+
     LockTracingState();
 
     DEBUG_BREAK_IF(handle->handle == nullptr);
     for (size_t i = 0; i < tracingHandle.size(); ++i) {
         if (tracingHandle[i] == handle->handle) {
+            bool stopCollector = false;
             if (tracingHandle.size() == 1) {
                 tracingState.fetch_and(~TRACING_STATE_ENABLED_BIT, std::memory_order_acq_rel);
+                stopCollector = deferredTracingEnabled.exchange(false, std::memory_order_acq_rel);
                 std::vector<TracingHandle *>().swap(tracingHandle);
             } else {
                 tracingHandle[i] = tracingHandle[tracingHandle.size() - 1];
                 tracingHandle.pop_back();
             }
             UnlockTracingState();
+            if (stopCollector) {
+                stopDeferredTracing();
+            }
             return CL_SUCCESS;
         }
     }
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/tracing_collector.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "opencl/source/tracing/tracing_handle.h"
+#include "opencl/source/tracing/tracing_notify.h"
+
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace HostSideTracing {
+
+std::atomic<bool> deferredTracingEnabled(false);
+
+namespace {
+std::mutex queuesMutex;
+std::vector<std::unique_ptr<TracingRecordsQueue>> queues;
+
+std::mutex collectorMutex;
+std::unique_ptr<NEO::Thread> collectorThread;
+std::atomic<bool> collectorRunning(false);
+
+// collector sleeps until records are pushed, producers notify it only when it is waiting
+std::mutex collectorWakeMutex;
+std::condition_variable collectorWakeCondition;
+std::atomic<bool> collectorWaiting(false);
+
+std::mutex deliveryMutex;
+std::unordered_map<uint32_t, std::array<uint64_t, TRACING_MAX_HANDLE_COUNT>> correlationData;
+
+struct ThreadTracingState {
+    ~ThreadTracingState() {
+        if (queue) {
+            queue->inUse.store(false, std::memory_order_release);
+        }
+    }
+
+    TracingRecordsQueue *queue = nullptr;
+    cl_uint nextCorrelationId = 0u;
+    cl_uint correlationIdsLeft = 0u;
+};
+thread_local ThreadTracingState threadTracingState;
+
+TracingRecordsQueue *acquireQueue() {
+    std::lock_guard<std::mutex> lock(queuesMutex);
+    for (auto &queue : queues) {
+        bool inUse = false;
+        if (queue->inUse.compare_exchange_strong(inUse, true, std::memory_order_acq_rel)) {
+            return queue.get();
+        }
+    }
+    queues.push_back(std::make_unique<TracingRecordsQueue>(TRACING_DEFERRED_RECORDS_PER_THREAD));
+    return queues.back().get();
+}
+
+void pushRecord(const TracingRecord &record) {
+    auto &state = threadTracingState;
+    if (state.queue == nullptr) {
+        state.queue = acquireQueue();
+    }
+    AtomicBackoff backoff;
+    while (!state.queue->push(record)) {
+        // queue is full, wait for collector unless it is being stopped
+        if (!deferredTracingEnabled.load(std::memory_order_acquire)) {
+            return;
+        }
+        backoff.pause();
+    }
+
+    if (collectorWaiting.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(collectorWakeMutex);
+        collectorWakeCondition.notify_one();
+    }
+}
+
+bool hasPendingRecords() {
+    std::lock_guard<std::mutex> lock(queuesMutex);
+    for (auto &queue : queues) {
+        if (!queue->isEmpty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void deliverRecord(const TracingRecord &record) {
+    auto callDataIt = correlationData.find(record.correlationId);
+    if (record.site == CL_CALLBACK_SITE_ENTER) {
+        callDataIt = correlationData.emplace(record.correlationId, std::array<uint64_t, TRACING_MAX_HANDLE_COUNT>{}).first;
+    } else if (callDataIt == correlationData.end()) {
+        // exit of a call entered before tracing was enabled
+        return;
+    }
+
+    cl_callback_data data = {};
+    data.site = record.site;
+    data.correlationId = record.correlationId;
+    data.functionName = record.functionName;
+    data.functionParams = nullptr;
+    data.functionReturnValue = nullptr;
+    auto returnValue = record.returnValue;
+    if (record.hasReturnValue) {
+        data.functionReturnValue = &returnValue;
+    }
+
+    for (size_t i = 0; i < tracingHandle.size(); ++i) {
+        TracingHandle *handle = tracingHandle[i];
+        DEBUG_BREAK_IF(handle == nullptr);
+        if (handle->getTracingPoint(record.functionId)) {
+            data.correlationData = callDataIt->second.data() + i;
+            handle->call(record.functionId, &data);
+        }
+    }
+
+    if (record.site == CL_CALLBACK_SITE_EXIT) {
+        correlationData.erase(callDataIt);
+    }
+}
+
+void *collectorThreadBody(void *) {
+    while (collectorRunning.load(std::memory_order_acquire)) {
+        deliverDeferredRecords();
+
+        std::unique_lock<std::mutex> lock(collectorWakeMutex);
+        collectorWaiting.store(true, std::memory_order_seq_cst);
+        collectorWakeCondition.wait(lock, [] {
+            return !collectorRunning.load(std::memory_order_acquire) || hasPendingRecords();
+        });
+        collectorWaiting.store(false, std::memory_order_relaxed);
+    }
+    return nullptr;
+}
+
+struct CollectorThreadGuard {
+    ~CollectorThreadGuard() {
+        deferredTracingEnabled.store(false);
+        stopDeferredTracing();
+    }
+};
+CollectorThreadGuard collectorThreadGuard;
+} // namespace
+
+cl_uint recordDeferredEnter(cl_function_id functionId, const char *functionName) {
+    auto &state = threadTracingState;
+    if (state.correlationIdsLeft == 0u) {
+        // correlation ids are reserved in blocks to avoid shared atomic traffic on every call
+        state.nextCorrelationId = tracingCorrelationId.fetch_add(TRACING_DEFERRED_CORRELATION_IDS_PER_THREAD, std::memory_order_acq_rel);
+        state.correlationIdsLeft = TRACING_DEFERRED_CORRELATION_IDS_PER_THREAD;
+    }
+    state.correlationIdsLeft--;
+    auto correlationId = state.nextCorrelationId++;
+
+    TracingRecord record;
+    record.functionName = functionName;
+    record.functionId = functionId;
+    record.site = CL_CALLBACK_SITE_ENTER;
+    record.correlationId = correlationId;
+    pushRecord(record);
+    return correlationId;
+}
+
+void recordDeferredExit(cl_function_id functionId, const char *functionName, cl_uint correlationId, const void *returnValue, size_t returnValueSize) {
+    TracingRecord record;
+    record.functionName = functionName;
+    record.functionId = functionId;
+    record.site = CL_CALLBACK_SITE_EXIT;
+    record.correlationId = correlationId;
+    if (returnValue) {
+        memcpy_s(&record.returnValue, sizeof(record.returnValue), returnValue, returnValueSize);
+        record.hasReturnValue = true;
+    }
+    pushRecord(record);
+}
+
+bool isDeferredTracingRequested() {
+    return NEO::DebugManager.flags.EnableDeferredHostSideTracing.get() == 1;
+}
+
+void startDeferredTracing() {
+    std::lock_guard<std::mutex> lock(collectorMutex);
+    if (collectorThread) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> queuesLock(queuesMutex);
+        for (auto &queue : queues) {
+            queue->skipAll();
+        }
+    }
+    {
+        std::lock_guard<std::mutex> deliveryLock(deliveryMutex);
+        correlationData.clear();
+    }
+    collectorRunning.store(true, std::memory_order_release);
+    collectorThread = NEO::Thread::create(collectorThreadBody, nullptr);
+}
+
+void stopDeferredTracing() {
+    std::lock_guard<std::mutex> lock(collectorMutex);
+    if (!collectorThread || deferredTracingEnabled.load(std::memory_order_acquire)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> wakeLock(collectorWakeMutex);
+        collectorRunning.store(false, std::memory_order_release);
+        collectorWakeCondition.notify_one();
+    }
+    collectorThread->join();
+    collectorThread.reset();
+}
+
+void deliverDeferredRecords() {
+    std::lock_guard<std::mutex> lock(deliveryMutex);
+    // collector is a regular tracing client, so handles can't be enabled or disabled during delivery
+    if (!addTracingClient()) {
+        return;
+    }
+
+    std::vector<TracingRecordsQueue *> queuesToConsume;
+    {
+        std::lock_guard<std::mutex> queuesLock(queuesMutex);
+        queuesToConsume.reserve(queues.size());
+        for (auto &queue : queues) {
+            queuesToConsume.push_back(queue.get());
+        }
+    }
+    for (auto queue : queuesToConsume) {
+        queue->consume(deliverRecord);
+    }
+
+    removeTracingClient();
+}
+
+} // namespace HostSideTracing
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "opencl/source/tracing/tracing_types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace HostSideTracing {
+
+struct TracingRecord {
+    const char *functionName = nullptr;
+    cl_function_id functionId = CL_FUNCTION_COUNT;
+    cl_callback_site site = CL_CALLBACK_SITE_ENTER;
+    cl_uint correlationId = 0u;
+    // return value is copied, as its storage does not outlive the traced call
+    uint64_t returnValue = 0u;
+    bool hasReturnValue = false;
+};
+
+// Single producer single consumer queue. Producer is the thread calling traced API functions,
+// consumer is the collector delivering records to tracing callbacks.
+class TracingRecordsQueue {
+  public:
+    explicit TracingRecordsQueue(size_t capacity) : records(capacity) {}
+
+    bool push(const TracingRecord &record) {
+        auto position = writeIndex.load(std::memory_order_relaxed);
+        if (position - readIndex.load(std::memory_order_acquire) == records.size()) {
+            return false;
+        }
+        records[position % records.size()] = record;
+        // sequentially consistent, so either a waiting collector is seen by producer or the record by collector
+        writeIndex.store(position + 1, std::memory_order_seq_cst);
+        return true;
+    }
+
+    template <typename FuncT>
+    size_t consume(FuncT &&func) {
+        auto position = readIndex.load(std::memory_order_relaxed);
+        auto endPosition = writeIndex.load(std::memory_order_acquire);
+        for (auto i = position; i < endPosition; i++) {
+            func(records[i % records.size()]);
+        }
+        readIndex.store(endPosition, std::memory_order_release);
+        return static_cast<size_t>(endPosition - position);
+    }
+
+    bool isEmpty() const {
+        return readIndex.load(std::memory_order_acquire) == writeIndex.load(std::memory_order_seq_cst);
+    }
+
+    void skipAll() {
+        readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    std::atomic<bool> inUse{true};
+
+  protected:
+    std::vector<TracingRecord> records;
+    std::atomic<uint64_t> writeIndex{0u};
+    // keeps producer and consumer indices in separate cache lines
+    uint8_t cacheLinePadding[64] = {};
+    std::atomic<uint64_t> readIndex{0u};
+};
+
+constexpr size_t TRACING_DEFERRED_RECORDS_PER_THREAD = 4096;
+constexpr cl_uint TRACING_DEFERRED_CORRELATION_IDS_PER_THREAD = 1024;
+
+extern std::atomic<bool> deferredTracingEnabled;
+
+cl_uint recordDeferredEnter(cl_function_id functionId, const char *functionName);
+void recordDeferredExit(cl_function_id functionId, const char *functionName, cl_uint correlationId, const void *returnValue, size_t returnValueSize);
+
+template <typename ReturnValueT>
+void recordDeferredExit(cl_function_id functionId, const char *functionName, cl_uint correlationId, const ReturnValueT *returnValue) {
+    static_assert(sizeof(ReturnValueT) <= sizeof(TracingRecord::returnValue), "return value has to fit in tracing record");
+    recordDeferredExit(functionId, functionName, correlationId, returnValue, sizeof(ReturnValueT));
+}
+
+inline void recordDeferredExit(cl_function_id functionId, const char *functionName, cl_uint correlationId, std::nullptr_t) {
+    recordDeferredExit(functionId, functionName, correlationId, nullptr, 0u);
+}
+
+bool isDeferredTracingRequested();
+void startDeferredTracing();
+void stopDeferredTracing();
+void deliverDeferredRecords();
+
+} // namespace HostSideTracing
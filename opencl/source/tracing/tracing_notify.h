@@ -9,6 +9,7 @@
 
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include "opencl/source/tracing/tracing_collector.h"
 #include "opencl/source/tracing/tracing_handle.h"
 
 #include <atomic>
@@ -28,20 +29,29 @@ namespace HostSideTracing {
 #define TRACING_ZERO_CLIENT_COUNTER(state) ((state) & (HostSideTracing::TRACING_STATE_ENABLED_BIT | HostSideTracing::TRACING_STATE_LOCKED_BIT))
 #define TRACING_GET_CLIENT_COUNTER(state) ((state) & (~(HostSideTracing::TRACING_STATE_ENABLED_BIT | HostSideTracing::TRACING_STATE_LOCKED_BIT)))
 
-#define TRACING_ENTER(name, ...)                                                                  \
-    bool isHostSideTracingEnabled_##name = false;                                                 \
-    HostSideTracing::name##Tracer tracer_##name;                                                  \
-    if (TRACING_GET_ENABLED_BIT(HostSideTracing::tracingState.load(std::memory_order_acquire))) { \
-        isHostSideTracingEnabled_##name = HostSideTracing::addTracingClient();                    \
-        if (isHostSideTracingEnabled_##name) {                                                    \
-            tracer_##name.enter(__VA_ARGS__);                                                     \
-        }                                                                                         \
-    }
-
-#define TRACING_EXIT(name, ...)                 \
-    if (isHostSideTracingEnabled_##name) {      \
-        tracer_##name.exit(__VA_ARGS__);        \
-        HostSideTracing::removeTracingClient(); \
+#define TRACING_ENTER(name, ...)                                                                            \
+    bool isHostSideTracingEnabled_##name = false;                                                           \
+    bool isHostSideTracingDeferred_##name = false;                                                          \
+    cl_uint deferredCorrelationId_##name = 0u;                                                              \
+    HostSideTracing::name##Tracer tracer_##name;                                                            \
+    if (TRACING_GET_ENABLED_BIT(HostSideTracing::tracingState.load(std::memory_order_acquire))) {           \
+        if (HostSideTracing::deferredTracingEnabled.load(std::memory_order_acquire)) {                      \
+            isHostSideTracingDeferred_##name = true;                                                        \
+            deferredCorrelationId_##name = HostSideTracing::recordDeferredEnter(CL_FUNCTION_##name, #name); \
+        } else {                                                                                            \
+            isHostSideTracingEnabled_##name = HostSideTracing::addTracingClient();                          \
+            if (isHostSideTracingEnabled_##name) {                                                          \
+                tracer_##name.enter(__VA_ARGS__);                                                           \
+            }                                                                                               \
+        }                                                                                                   \
+    }
+
+#define TRACING_EXIT(name, ...)                                                                                    \
+    if (isHostSideTracingEnabled_##name) {                                                                         \
+        tracer_##name.exit(__VA_ARGS__);                                                                           \
+        HostSideTracing::removeTracingClient();                                                                    \
+    } else if (isHostSideTracingDeferred_##name) {                                                                 \
+        HostSideTracing::recordDeferredExit(CL_FUNCTION_##name, #name, deferredCorrelationId_##name, __VA_ARGS__); \
     }
 
 typedef enum _tracing_notify_state_t {
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/utilities/async_log_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace NEO {
+
+std::atomic<uint64_t> AsyncLogWriter::writerIdCounter{0u};
+
+namespace {
+constexpr std::chrono::milliseconds writerPollingInterval(10);
+}
+
+AsyncLogWriter::AsyncLogWriter(WriteFunc writeFunc, size_t memoryLimit)
+    : writerId(++writerIdCounter), writeFunc(std::move(writeFunc)), memoryLimit(memoryLimit) {
+    writerThread = Thread::create(writerThreadFunc, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        stopRequested = true;
+    }
+    writerCondition.notify_one();
+    writerThread->join();
+    writeBufferedEntries();
+}
+
+bool AsyncLogWriter::write(const std::string &fileName, const char *data, size_t size, std::ios_base::openmode mode) {
+    auto previouslyBuffered = bufferedBytes.fetch_add(size);
+    if (previouslyBuffered + size > memoryLimit) {
+        bufferedBytes.fetch_sub(size);
+        droppedWrites++;
+        return false;
+    }
+
+    auto &threadBuffer = getThreadBuffer();
+    {
+        std::lock_guard<std::mutex> lock(threadBuffer.mtx);
+        threadBuffer.entries.push_back({sequence++, fileName, mode, std::string(data, size)});
+    }
+
+    if (previouslyBuffered < memoryLimit / 2 && previouslyBuffered + size >= memoryLimit / 2) {
+        writerCondition.notify_one();
+    }
+    return true;
+}
+
+void AsyncLogWriter::flush() {
+    writeBufferedEntries();
+}
+
+AsyncLogWriter::ThreadBuffer &AsyncLogWriter::getThreadBuffer() {
+    struct CachedThreadBuffer {
+        uint64_t writerId = 0u;
+        ThreadBuffer *buffer = nullptr;
+    };
+    thread_local CachedThreadBuffer cached;
+
+    if (cached.writerId != writerId) {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffers.push_back(std::make_unique<ThreadBuffer>());
+        cached.buffer = buffers.back().get();
+        cached.writerId = writerId;
+    }
+    return *cached.buffer;
+}
+
+void *AsyncLogWriter::writerThreadFunc(void *self) {
+    auto writer = static_cast<AsyncLogWriter *>(self);
+    std::unique_lock<std::mutex> lock(writer->writerMutex);
+    while (!writer->stopRequested) {
+        writer->writerCondition.wait_for(lock, writerPollingInterval);
+        lock.unlock();
+        writer->writeBufferedEntries();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+void AsyncLogWriter::writeBufferedEntries() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+
+    std::vector<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto &buffer : buffers) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mtx);
+            std::move(buffer->entries.begin(), buffer->entries.end(), std::back_inserter(entries));
+            buffer->entries.clear();
+        }
+    }
+    if (entries.empty()) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry &lhs, const Entry &rhs) { return lhs.sequence < rhs.sequence; });
+
+    // consecutive appends to the same file are passed as a single write
+    size_t writtenBytes = 0;
+    for (size_t i = 0; i < entries.size();) {
+        auto &entry = entries[i];
+        writtenBytes += entry.data.size();
+        size_t next = i + 1;
+        if (entry.mode & std::ios::app) {
+            while (next < entries.size() && entries[next].mode == entry.mode && entries[next].fileName == entry.fileName) {
+                writtenBytes += entries[next].data.size();
+                entry.data += entries[next].data;
+                next++;
+            }
+        }
+        writeFunc(entry.fileName, entry.data.c_str(), entry.data.size(), entry.mode);
+        i = next;
+    }
+    bufferedBytes.fetch_sub(writtenBytes);
+}
+} // namespace NEO
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Buffers file writes in per-thread buffers and passes them to writeFunc on a background thread.
+// When buffered data would exceed memoryLimit, new writes are dropped and counted.
+class AsyncLogWriter : NonCopyableOrMovableClass {
+  public:
+    using WriteFunc = std::function<void(const std::string &fileName, const char *data, size_t size, std::ios_base::openmode mode)>;
+
+    static constexpr size_t defaultMemoryLimit = 16 * 1024 * 1024;
+
+    AsyncLogWriter(WriteFunc writeFunc, size_t memoryLimit);
+    ~AsyncLogWriter();
+
+    bool write(const std::string &fileName, const char *data, size_t size, std::ios_base::openmode mode);
+
+    // Writes out everything buffered before the call
+    void flush();
+
+    uint64_t getDroppedWritesCount() const { return droppedWrites.load(); }
+    size_t getBufferedBytes() const { return bufferedBytes.load(); }
+
+  protected:
+    struct Entry {
+        uint64_t sequence;
+        std::string fileName;
+        std::ios_base::openmode mode;
+        std::string data;
+    };
+
+    struct ThreadBuffer {
+        std::mutex mtx;
+        std::vector<Entry> entries;
+    };
+
+    static void *writerThreadFunc(void *self);
+
+    ThreadBuffer &getThreadBuffer();
+    void writeBufferedEntries();
+
+    static std::atomic<uint64_t> writerIdCounter;
+    const uint64_t writerId;
+    WriteFunc writeFunc;
+    const size_t memoryLimit;
+
+    std::atomic<uint64_t> sequence{0u};
+    std::atomic<size_t> bufferedBytes{0u};
+    std::atomic<uint64_t> droppedWrites{0u};
+
+    std::mutex buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    std::mutex drainMutex;
+
+    std::mutex writerMutex;
+    std::condition_variable writerCondition;
+    bool stopRequested = false;
+    std::unique_ptr<Thread> writerThread;
+};
+} // namespace NEO
@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/memory_manager/memory_constants.h"
 
 #include "opencl/source/event/event.h"
 #include "opencl/source/helpers/dispatch_info.h"
@@ -34,10 +35,30 @@ FileLogger<DebugLevel>::FileLogger(std::string filename, const DebugVariables &f
     dumpKernelArgsEnabled = flags.DumpKernelArgs.get();
     logApiCalls = flags.LogApiCalls.get();
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
+
+    if (enabled() && flags.EnableAsyncFileLogging.get() == 1) {
+        size_t memoryLimit = AsyncLogWriter::defaultMemoryLimit;
+        if (flags.AsyncFileLoggingMemoryLimitInKb.get() > 0) {
+            memoryLimit = static_cast<size_t>(flags.AsyncFileLoggingMemoryLimitInKb.get() * MemoryConstants::kiloByte);
+        }
+        auto writeFunc = [this](const std::string &filename, const char *str, size_t length, std::ios_base::openmode mode) {
+            writeToFile(filename, str, length, mode);
+        };
+        asyncWriter = std::make_unique<AsyncLogWriter>(writeFunc, memoryLimit);
+    }
 }
 
 template <DebugFunctionalityLevel DebugLevel>
-FileLogger<DebugLevel>::~FileLogger() = default;
+FileLogger<DebugLevel>::~FileLogger() {
+    if (asyncWriter) {
+        auto droppedWrites = asyncWriter->getDroppedWritesCount();
+        asyncWriter.reset();
+        if (droppedWrites > 0) {
+            auto str = "Log writes dropped: " + std::to_string(droppedWrites) + "\n";
+            writeToFile(logFileName, str.c_str(), str.size(), std::ios::app);
+        }
+    }
+}
 
 template <DebugFunctionalityLevel DebugLevel>
 void FileLogger<DebugLevel>::writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode) {
@@ -48,6 +69,28 @@ void FileLogger<DebugLevel>::writeToFile(std::string filename, const char *str,
     }
 }
 
+template <DebugFunctionalityLevel DebugLevel>
+void FileLogger<DebugLevel>::writeLog(const std::string &filename, const char *str, size_t length, std::ios_base::openmode mode) {
+    if (asyncWriter) {
+        asyncWriter->write(filename, str, length, mode);
+        return;
+    }
+    std::unique_lock<std::mutex> theLock(mtx);
+    writeToFile(filename, str, length, mode);
+}
+
+template <DebugFunctionalityLevel DebugLevel>
+void FileLogger<DebugLevel>::flush() {
+    if (asyncWriter) {
+        asyncWriter->flush();
+    }
+}
+
+template <DebugFunctionalityLevel DebugLevel>
+uint64_t FileLogger<DebugLevel>::getDroppedWritesCount() const {
+    return asyncWriter ? asyncWriter->getDroppedWritesCount() : 0u;
+}
+
 template <DebugFunctionalityLevel DebugLevel>
 void FileLogger<DebugLevel>::dumpKernel(const std::string &name, const std::string &src) {
     if (false == enabled()) {
@@ -56,7 +99,7 @@ void FileLogger<DebugLevel>::dumpKernel(const std::string &name, const std::stri
 
     if (dumpKernels) {
         DBG_LOG(LogApiCalls, "Kernel size", src.size(), src.c_str());
-        writeToFile(name + ".txt", src.c_str(), src.size(), std::ios::trunc);
+        writeLog(name + ".txt", src.c_str(), src.size(), std::ios::trunc);
     }
 }
 
@@ -67,7 +110,6 @@ void FileLogger<DebugLevel>::logApiCall(const char *function, bool enter, int32_
     }
 
     if (logApiCalls) {
-        std::unique_lock<std::mutex> theLock(mtx);
         std::thread::id thisThread = std::this_thread::get_id();
 
         std::stringstream ss;
@@ -79,7 +121,7 @@ void FileLogger<DebugLevel>::logApiCall(const char *function, bool enter, int32_
         ss << function << std::endl;
 
         auto str = ss.str();
-        writeToFile(logFileName, str.c_str(), str.size(), std::ios::app);
+        writeLog(logFileName, str.c_str(), str.size(), std::ios::app);
     }
 }
 
@@ -100,9 +142,7 @@ void FileLogger<DebugLevel>::logAllocation(GraphicsAllocation const *graphicsAll
         ss << std::endl;
 
         auto str = ss.str();
-
-        std::unique_lock<std::mutex> theLock(mtx);
-        writeToFile(logFileName, str.c_str(), str.size(), std::ios::app);
+        writeLog(logFileName, str.c_str(), str.size(), std::ios::app);
     }
 }
 
@@ -154,8 +194,7 @@ void FileLogger<DebugLevel>::dumpBinaryProgram(int32_t numDevices, const size_t
     if (dumpKernels) {
         if (lengths != nullptr && binaries != nullptr &&
             lengths[0] != 0 && binaries[0] != nullptr) {
-            std::unique_lock<std::mutex> theLock(mtx);
-            writeToFile("programBinary.bin", reinterpret_cast<const char *>(binaries[0]), lengths[0], std::ios::trunc | std::ios::binary);
+            writeLog("programBinary.bin", reinterpret_cast<const char *>(binaries[0]), lengths[0], std::ios::trunc | std::ios::binary);
         }
     }
 }
@@ -166,9 +205,6 @@ void FileLogger<DebugLevel>::dumpKernelArgs(const Kernel *kernel) {
         return;
     }
     if (dumpKernelArgsEnabled && kernel != nullptr) {
-        std::unique_lock<std::mutex> theLock(mtx);
-        std::ofstream outFile;
-
         for (unsigned int i = 0; i < kernel->getKernelInfo().kernelArgInfo.size(); i++) {
             std::string type;
             std::string fileName;
@@ -220,7 +256,7 @@ void FileLogger<DebugLevel>::dumpKernelArgs(const Kernel *kernel) {
 
             if (ptr && size) {
                 fileName = kernel->getKernelInfo().name + "_arg_" + std::to_string(i) + "_" + type + "_size_" + std::to_string(size) + "_flags_" + std::to_string(flags) + ".bin";
-                writeToFile(fileName, ptr, size, std::ios::trunc | std::ios::binary);
+                writeLog(fileName, ptr, size, std::ios::trunc | std::ios::binary);
             }
         }
     }
@@ -8,6 +8,8 @@
 #pragma once
 #include "shared/source/debug_settings/debug_settings_manager.h"
 
+#include "opencl/source/utilities/async_log_writer.h"
+
 #include <cinttypes>
 #include <cstddef>
 #include <iostream>
@@ -41,6 +43,9 @@ class FileLogger {
     const std::string getMemObjects(const uintptr_t *input, uint32_t numOfObjects);
 
     MOCKABLE_VIRTUAL void writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode);
+    void writeLog(const std::string &filename, const char *str, size_t length, std::ios_base::openmode mode);
+    void flush();
+    uint64_t getDroppedWritesCount() const;
 
     void dumpBinaryProgram(int32_t numDevices, const size_t *lengths, const unsigned char **binaries);
     void dumpKernelArgs(const Kernel *kernel);
@@ -96,13 +101,13 @@ class FileLogger {
     void logInputs(Types &&... params) {
         if (enabled()) {
             if (logApiCalls) {
-                std::unique_lock<std::mutex> theLock(mtx);
                 std::thread::id thisThread = std::this_thread::get_id();
                 std::stringstream ss;
                 ss << "------------------------------\n";
                 printInputs(ss, "ThreadID", thisThread, params...);
                 ss << "------------------------------" << std::endl;
-                writeToFile(logFileName, ss.str().c_str(), ss.str().length(), std::ios::app);
+                auto str = ss.str();
+                writeLog(logFileName, str.c_str(), str.length(), std::ios::app);
             }
         }
     }
@@ -120,11 +125,11 @@ class FileLogger {
     void log(bool enableLog, Types... params) {
         if (enabled()) {
             if (enableLog) {
-                std::unique_lock<std::mutex> theLock(mtx);
                 std::thread::id thisThread = std::this_thread::get_id();
                 std::stringstream ss;
                 print(ss, "ThreadID", thisThread, params...);
-                writeToFile(logFileName, ss.str().c_str(), ss.str().length(), std::ios::app);
+                auto str = ss.str();
+                writeLog(logFileName, str.c_str(), str.length(), std::ios::app);
             }
         }
     }
@@ -143,6 +148,7 @@ class FileLogger {
   protected:
     std::mutex mtx;
     std::string logFileName;
+    std::unique_ptr<AsyncLogWriter> asyncWriter;
     bool dumpKernels = false;
     bool dumpKernelArgsEnabled = false;
     bool logApiCalls = false;
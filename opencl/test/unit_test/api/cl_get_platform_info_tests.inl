@@ -7,13 +7,18 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/utilities/runtime_counters.h"
 
+#include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/platform/platform.h"
 #include "test.h"
 
 #include "CL/cl_ext.h"
 #include "cl_api_tests.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace NEO;
 
 struct clGetPlatformInfoTests : public api_tests {
@@ -121,6 +126,24 @@ TEST_F(clGetPlatformInfoTests, GivenClPlatformHostTimerResolutionWhenGettingPlat
     EXPECT_EQ(resolution, value);
 }
 
+TEST_F(clGetPlatformInfoTests, GivenClPlatformRuntimeCountersWhenGettingPlatformInfoThenValueForEachCounterNameIsReturned) {
+    RuntimeCounters::increment(RuntimeCounter::compilerCacheHits, 3u);
+
+    retVal = clGetPlatformInfo(pPlatform, CL_PLATFORM_RUNTIME_COUNTERS_INTEL, 0, nullptr, &retSize);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(RuntimeCounters::valuesCount * sizeof(cl_ulong), retSize);
+
+    std::vector<cl_ulong> values(RuntimeCounters::valuesCount);
+    retVal = clGetPlatformInfo(pPlatform, CL_PLATFORM_RUNTIME_COUNTERS_INTEL, retSize, values.data(), nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_LE(3u, values[static_cast<uint32_t>(RuntimeCounter::compilerCacheHits)]);
+
+    paramValue = getPlatformInfoString(pPlatform, CL_PLATFORM_RUNTIME_COUNTER_NAMES_INTEL);
+    std::string names(paramValue);
+    EXPECT_EQ(RuntimeCounters::valuesCount, static_cast<size_t>(std::count(names.begin(), names.end(), '\n')));
+    EXPECT_EQ(0u, names.find("flushTasks\n"));
+}
+
 TEST_F(clGetPlatformInfoTests, GivenNullPlatformWhenGettingPlatformInfoStringThenClInvalidPlatformErrorIsReturned) {
     char extensions[512];
     retVal = clGetPlatformInfo(
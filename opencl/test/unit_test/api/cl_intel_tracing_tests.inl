@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
 #include "opencl/source/tracing/tracing_api.h"
 #include "opencl/source/tracing/tracing_notify.h"
 #include "opencl/test/unit_test/api/cl_api_tests.h"
@@ -185,6 +187,58 @@ TEST_F(IntelTracingTest, EnableTwoHandlesExpectPass) {
     EXPECT_EQ(CL_SUCCESS, status);
 }
 
+struct IntelDeferredTracingTest : public IntelTracingTest {
+  protected:
+    void vcallback(cl_function_id fid, cl_callback_data *callbackData, void *userData) override {
+        EXPECT_EQ(CL_FUNCTION_clGetPlatformInfo, fid);
+        EXPECT_STREQ("clGetPlatformInfo", callbackData->functionName);
+        EXPECT_EQ(nullptr, callbackData->functionParams);
+        EXPECT_NE(nullptr, callbackData->correlationData);
+
+        if (callbackData->site == CL_CALLBACK_SITE_ENTER) {
+            EXPECT_EQ(nullptr, callbackData->functionReturnValue);
+            correlationId = callbackData->correlationId;
+            callbackData->correlationData[0] = 777ull;
+            ++enterCount;
+        } else {
+            EXPECT_EQ(correlationId, callbackData->correlationId);
+            EXPECT_EQ(777ull, callbackData->correlationData[0]);
+            ASSERT_NE(nullptr, callbackData->functionReturnValue);
+            EXPECT_EQ(CL_SUCCESS, *reinterpret_cast<cl_int *>(callbackData->functionReturnValue));
+            ++exitCount;
+        }
+    }
+
+    uint32_t correlationId = 0;
+    uint32_t enterCount = 0;
+    uint32_t exitCount = 0;
+};
+
+TEST_F(IntelDeferredTracingTest, givenDeferredHostSideTracingWhenTracingIsDisabledThenBufferedCallsAreDeliveredWithReturnValueAndWithoutParams) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeferredHostSideTracing.set(1);
+
+    status = clCreateTracingHandleINTEL(devices[testedRootDeviceIndex], callback, this, &handle);
+    ASSERT_EQ(CL_SUCCESS, status);
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetPlatformInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clEnableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    size_t paramValueSizeRet = 0;
+    status = clGetPlatformInfo(pPlatform, CL_PLATFORM_VERSION, 0, nullptr, &paramValueSizeRet);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    status = clDisableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_FALSE(HostSideTracing::deferredTracingEnabled.load());
+    EXPECT_EQ(1u, enterCount);
+    EXPECT_EQ(1u, exitCount);
+
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+}
+
 struct IntelAllTracingTest : public IntelTracingTest {
   public:
     IntelAllTracingTest() {}
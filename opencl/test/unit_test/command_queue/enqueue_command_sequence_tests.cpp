@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/command_queue/command_sequence.h"
+#include "opencl/source/helpers/task_information.h"
+#include "opencl/test/unit_test/command_queue/enqueue_fixture.h"
+#include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
+#include "opencl/test/unit_test/helpers/hw_parse.h"
+#include "test.h"
+
+using namespace NEO;
+
+struct EnqueueCommandSequenceTest : public HelloWorldTest<HelloWorldFixtureFactory>,
+                                    public HardwareParse {
+    void SetUp() override {
+        HelloWorldTest<HelloWorldFixtureFactory>::SetUp();
+        HardwareParse::SetUp();
+    }
+
+    void TearDown() override {
+        HardwareParse::TearDown();
+        HelloWorldTest<HelloWorldFixtureFactory>::TearDown();
+    }
+
+    std::unique_ptr<CommandSequence> recordSequence(uint32_t dispatchesCount) {
+        EXPECT_EQ(CL_SUCCESS, pCmdQ->beginRecording());
+        for (uint32_t i = 0; i < dispatchesCount; i++) {
+            EXPECT_EQ(CL_SUCCESS, EnqueueKernelHelper<>::enqueueKernel(pCmdQ, pKernel));
+        }
+        return pCmdQ->endRecording();
+    }
+};
+
+HWTEST_F(EnqueueCommandSequenceTest, givenRecordingQueueWhenKernelIsEnqueuedThenDispatchIsRecordedAndNotSubmitted) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto taskCountBefore = csr.peekTaskCount();
+    auto csUsedBefore = pCmdQ->getCS(0).getUsed();
+
+    auto commandSequence = recordSequence(2);
+
+    ASSERT_NE(nullptr, commandSequence);
+    EXPECT_FALSE(pCmdQ->isRecording());
+    EXPECT_EQ(2u, commandSequence->getDispatchesCount());
+    EXPECT_NE(pKernel, commandSequence->getDispatch(0).kernel);
+    EXPECT_NE(commandSequence->getDispatch(0).kernel, commandSequence->getDispatch(1).kernel);
+    EXPECT_EQ(taskCountBefore, csr.peekTaskCount());
+    EXPECT_EQ(csUsedBefore, pCmdQ->getCS(0).getUsed());
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenRecordingQueueWhenRecordingIsStartedAgainOrEventIsRequestedThenInvalidOperationIsReturned) {
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->beginRecording());
+    EXPECT_EQ(CL_INVALID_OPERATION, pCmdQ->beginRecording());
+
+    cl_event event = nullptr;
+    auto retVal = EnqueueKernelHelper<>::enqueueKernel(pCmdQ, pKernel, EnqueueKernelTraits::workDim, EnqueueKernelTraits::globalWorkOffset,
+                                                       EnqueueKernelTraits::globalWorkSize, EnqueueKernelTraits::localWorkSize, 0, nullptr, &event);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    auto commandSequence = pCmdQ->endRecording();
+    EXPECT_TRUE(commandSequence->empty());
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->beginRecording());
+    EXPECT_EQ(CL_INVALID_OPERATION, pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr));
+    pCmdQ->endRecording();
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenRecordedSequenceWhenItIsEnqueuedThenWalkersAreRecordedOnceAndReplayedWithSecondLevelBatchBufferStart) {
+    typedef typename FamilyType::PIPE_CONTROL PIPE_CONTROL;
+    typedef typename FamilyType::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = false;
+    csr.storeMakeResidentAllocations = true;
+    auto commandSequence = recordSequence(3);
+
+    auto taskCountBefore = csr.peekTaskCount();
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr));
+    auto recordedCommands = commandSequence->getRecordedCommands();
+    ASSERT_NE(nullptr, recordedCommands);
+    auto &recordedCommandStream = *recordedCommands->kernelOperation->commandStream;
+    auto recordedCommandStreamUsed = recordedCommandStream.getUsed();
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr));
+    EXPECT_EQ(taskCountBefore + 2, csr.peekTaskCount());
+    EXPECT_EQ(recordedCommands, commandSequence->getRecordedCommands());
+    EXPECT_EQ(recordedCommandStreamUsed, recordedCommandStream.getUsed());
+    EXPECT_TRUE(csr.isMadeResident(recordedCommandStream.getGraphicsAllocation(), csr.peekTaskCount()));
+
+    parseCommands<FamilyType>(pCmdQ->getCS(0), 0);
+    EXPECT_EQ(cmdList.end(), find<typename FamilyType::WALKER_TYPE *>(cmdList.begin(), cmdList.end()));
+    auto batchBufferStarts = findAll<MI_BATCH_BUFFER_START *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(2u, batchBufferStarts.size());
+    for (auto &it : batchBufferStarts) {
+        auto batchBufferStart = genCmdCast<MI_BATCH_BUFFER_START *>(*it);
+        EXPECT_EQ(MI_BATCH_BUFFER_START::SECOND_LEVEL_BATCH_BUFFER_SECOND_LEVEL_BATCH, batchBufferStart->getSecondLevelBatchBuffer());
+        EXPECT_EQ(recordedCommandStream.getGraphicsAllocation()->getGpuAddress(), batchBufferStart->getBatchBufferStartAddressGraphicsaddress472());
+    }
+
+    cmdList.clear();
+    parseCommands<FamilyType>(recordedCommandStream, 0);
+    auto walkers = findAll<typename FamilyType::WALKER_TYPE *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(3u, walkers.size());
+    for (size_t i = 1; i < walkers.size(); i++) {
+        EXPECT_NE(walkers[i], find<PIPE_CONTROL *>(walkers[i - 1], walkers[i]));
+    }
+    EXPECT_NE(cmdList.end(), find<typename FamilyType::MI_BATCH_BUFFER_END *>(walkers.back(), cmdList.end()));
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenProfilingEventRequestedWhenRecordedSequenceIsEnqueuedThenAllWalkersAreProgrammedIntoQueueCommandStreamWithSingleFlush) {
+    typedef typename FamilyType::PIPE_CONTROL PIPE_CONTROL;
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto commandSequence = recordSequence(3);
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    auto profilingQueue = std::make_unique<CommandQueueHw<FamilyType>>(context, pClDevice, properties, false);
+    cl_event event = nullptr;
+
+    auto taskCountBefore = csr.peekTaskCount();
+    auto retVal = profilingQueue->enqueueCommandSequence(*commandSequence, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 1, csr.peekTaskCount());
+    EXPECT_EQ(nullptr, commandSequence->getRecordedCommands());
+
+    parseCommands<FamilyType>(*profilingQueue);
+    auto walkers = findAll<typename FamilyType::WALKER_TYPE *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(3u, walkers.size());
+    for (size_t i = 1; i < walkers.size(); i++) {
+        EXPECT_NE(walkers[i], find<PIPE_CONTROL *>(walkers[i - 1], walkers[i]));
+    }
+    clReleaseEvent(event);
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenSingleSubmissionDisabledWhenRecordedSequenceIsEnqueuedThenEachDispatchIsSubmittedSeparately) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCommandSequenceSingleSubmission.set(0);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto commandSequence = recordSequence(3);
+
+    auto taskCountBefore = csr.peekTaskCount();
+    auto retVal = pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 3, csr.peekTaskCount());
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenRecordedKernelsWithDifferentPerSubmissionStateWhenSequenceIsEnqueuedThenEachDispatchIsSubmittedSeparately) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto commandSequence = recordSequence(2);
+    EXPECT_TRUE(commandSequence->isSingleSubmissionAllowed());
+
+    auto secondKernel = commandSequence->getDispatch(1).kernel;
+    secondKernel->setThreadArbitrationPolicy(commandSequence->getDispatch(0).kernel->getThreadArbitrationPolicy() == ThreadArbitrationPolicy::RoundRobin
+                                                 ? ThreadArbitrationPolicy::AgeBased
+                                                 : ThreadArbitrationPolicy::RoundRobin);
+    EXPECT_FALSE(commandSequence->isSingleSubmissionAllowed());
+
+    auto taskCountBefore = csr.peekTaskCount();
+    auto retVal = pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 2, csr.peekTaskCount());
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenRecordedSequenceWhenKernelArgIsPatchedThenOnlyRecordedDispatchIsUpdated) {
+    auto commandSequence = recordSequence(2);
+    cl_mem oldSrc = srcBuffer;
+    cl_mem newSrc = destBuffer;
+
+    EXPECT_EQ(CL_INVALID_VALUE, commandSequence->setKernelArg(2, 0, sizeof(cl_mem), &newSrc));
+    EXPECT_EQ(CL_INVALID_ARG_INDEX, commandSequence->setKernelArg(0, static_cast<uint32_t>(pKernel->getKernelArgsNumber()), sizeof(cl_mem), &newSrc));
+    EXPECT_EQ(CL_SUCCESS, commandSequence->setKernelArg(1, 0, sizeof(cl_mem), &newSrc));
+
+    EXPECT_EQ(oldSrc, pKernel->getKernelArg(0));
+    EXPECT_EQ(oldSrc, commandSequence->getDispatch(0).kernel->getKernelArg(0));
+    EXPECT_EQ(newSrc, commandSequence->getDispatch(1).kernel->getKernelArg(0));
+
+    auto retVal = pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenReplayedSequenceWhenKernelArgIsChangedThenIndirectDataIsPatchedInRecordedHeaps) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = false;
+    auto commandSequence = recordSequence(2);
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr));
+    auto recordedCommands = commandSequence->getRecordedCommands();
+    ASSERT_NE(nullptr, recordedCommands);
+    auto &dispatch = commandSequence->getDispatch(1);
+    ASSERT_TRUE(dispatch.patchable);
+    auto recordedCommandStreamUsed = recordedCommands->kernelOperation->commandStream->getUsed();
+
+    cl_mem newSrc = destBuffer;
+    EXPECT_EQ(CL_SUCCESS, commandSequence->setKernelArg(1, 0, sizeof(cl_mem), &newSrc));
+    EXPECT_TRUE(dispatch.argsChanged);
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr));
+    EXPECT_EQ(recordedCommands, commandSequence->getRecordedCommands());
+    EXPECT_EQ(recordedCommandStreamUsed, recordedCommands->kernelOperation->commandStream->getUsed());
+    EXPECT_FALSE(dispatch.argsChanged);
+
+    auto kernel = dispatch.kernel;
+    auto ioh = recordedCommands->kernelOperation->ioh.get();
+    EXPECT_EQ(0, memcmp(ptrOffset(ioh->getCpuBase(), dispatch.crossThreadDataOffset), kernel->getCrossThreadData(), kernel->getCrossThreadDataSize()));
+    auto surfaceStatesSize = CommandSequence::getPatchedSurfaceStatesSize(*kernel);
+    if (surfaceStatesSize > 0) {
+        auto ssh = recordedCommands->kernelOperation->ssh.get();
+        EXPECT_EQ(0, memcmp(ptrOffset(ssh->getCpuBase(), dispatch.surfaceStateOffset), kernel->getSurfaceStateHeap(), surfaceStatesSize));
+    }
+}
+
+HWTEST_F(EnqueueCommandSequenceTest, givenReplayedDispatchWhichCannotBePatchedWhenKernelArgIsChangedThenSequenceIsRecordedAgain) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = false;
+    auto commandSequence = recordSequence(2);
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr));
+    auto &dispatch = commandSequence->getDispatch(1);
+    dispatch.patchable = false;
+
+    cl_mem newSrc = destBuffer;
+    EXPECT_EQ(CL_SUCCESS, commandSequence->setKernelArg(1, 0, sizeof(cl_mem), &newSrc));
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueCommandSequence(*commandSequence, 0, nullptr, nullptr));
+    ASSERT_NE(nullptr, commandSequence->getRecordedCommands());
+    EXPECT_TRUE(dispatch.patchable);
+    EXPECT_FALSE(dispatch.argsChanged);
+}
@@ -11,6 +11,7 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/cache_policy.h"
@@ -1215,6 +1216,7 @@ HWTEST_F(BcsTests, givenAuxTranslationRequestWhenBlitCalledThenProgramCommandCor
 }
 
 struct MockScratchSpaceController : ScratchSpaceControllerBase {
+    using ScratchSpaceControllerBase::computeUnitsUsedForScratch;
     using ScratchSpaceControllerBase::privateScratchAllocation;
     using ScratchSpaceControllerBase::ScratchSpaceControllerBase;
 };
@@ -1227,3 +1229,118 @@ TEST_F(ScratchSpaceControllerTest, whenScratchSpaceControllerIsDestroyedThenItRe
     EXPECT_NE(nullptr, scratchSpaceController.privateScratchAllocation);
     //no memory leak is expected
 }
+
+struct ScratchSpacePoolTest : public ScratchSpaceControllerTest {
+    void SetUp() override {
+        DebugManager.flags.EnableScratchSpacePool.set(1);
+        ScratchSpaceControllerTest::SetUp();
+    }
+
+    std::unique_ptr<MockScratchSpaceController> createController() {
+        return std::make_unique<MockScratchSpaceController>(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(),
+                                                            *pDevice->getGpgpuCommandStreamReceiver().getInternalAllocationStorage());
+    }
+
+    void requireScratch(MockScratchSpaceController &controller, uint32_t perThreadScratchSize, uint32_t taskCount) {
+        controller.setRequiredScratchSpace(nullptr, perThreadScratchSize, 0u, taskCount, *pDevice->getDefaultEngine().osContext,
+                                           stateBaseAddressDirty, vfeStateDirty);
+    }
+
+    DebugManagerStateRestore restorer;
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+};
+
+TEST_F(ScratchSpacePoolTest, givenScratchSpacePoolWhenControllerIsDestroyedThenItsScratchAllocationIsReusedByAnotherController) {
+    auto controller = createController();
+    auto scratchSpacePool = controller->peekScratchSpacePool();
+    ASSERT_NE(nullptr, scratchSpacePool);
+
+    requireScratch(*controller, 0x2000, 0u);
+    auto scratchAllocation = controller->getScratchSpaceAllocation();
+    ASSERT_NE(nullptr, scratchAllocation);
+    EXPECT_EQ(scratchAllocation->getUnderlyingBufferSize(), scratchSpacePool->getHeldMemorySize());
+    controller.reset();
+    EXPECT_EQ(1u, scratchSpacePool->getCachedAllocationsCount());
+
+    auto secondController = createController();
+    EXPECT_EQ(scratchSpacePool, secondController->peekScratchSpacePool());
+    requireScratch(*secondController, 0x1000, 0u);
+    EXPECT_EQ(scratchAllocation, secondController->getScratchSpaceAllocation());
+    EXPECT_EQ(0u, scratchSpacePool->getCachedAllocationsCount());
+    EXPECT_EQ(1u, scratchSpacePool->getAllocationsCount());
+    EXPECT_EQ(1u, scratchSpacePool->getReusesCount());
+}
+
+TEST_F(ScratchSpacePoolTest, givenScratchAllocationBusyOnOtherContextWhenScratchIsRequiredThenNewAllocationIsCreated) {
+    auto controller = createController();
+    auto scratchSpacePool = controller->peekScratchSpacePool();
+    requireScratch(*controller, 0x1000, 0u);
+    auto scratchAllocation = controller->getScratchSpaceAllocation();
+
+    auto &engines = pDevice->getExecutionEnvironment()->memoryManager->getRegisteredEngines();
+    auto otherEngine = std::find_if(engines.begin(), engines.end(), [&](const EngineControl &engine) {
+        return engine.osContext != pDevice->getDefaultEngine().osContext;
+    });
+    if (otherEngine == engines.end()) {
+        GTEST_SKIP();
+    }
+    scratchAllocation->updateTaskCount(*otherEngine->commandStreamReceiver->getTagAddress() + 1, otherEngine->osContext->getContextId());
+    controller.reset();
+
+    auto secondController = createController();
+    requireScratch(*secondController, 0x1000, 0u);
+    EXPECT_NE(scratchAllocation, secondController->getScratchSpaceAllocation());
+    EXPECT_EQ(2u, scratchSpacePool->getAllocationsCount());
+    EXPECT_EQ(0u, scratchSpacePool->getReusesCount());
+
+    scratchAllocation->releaseUsageInOsContext(otherEngine->osContext->getContextId());
+}
+
+TEST_F(ScratchSpacePoolTest, givenZeroCachedSizeLimitWhenScratchSpaceGrowsThenPreviousAllocationIsReleased) {
+    DebugManager.flags.ScratchSpacePoolMaxCachedSizeInKb.set(0);
+    auto controller = createController();
+    auto scratchSpacePool = controller->peekScratchSpacePool();
+
+    requireScratch(*controller, 0x1000, 0u);
+    requireScratch(*controller, 0x2000, 0u);
+    auto scratchAllocation = controller->getScratchSpaceAllocation();
+    EXPECT_EQ(0u, scratchSpacePool->getCachedAllocationsCount());
+    EXPECT_EQ(scratchAllocation->getUnderlyingBufferSize(), scratchSpacePool->getHeldMemorySize());
+    EXPECT_EQ(2u, scratchSpacePool->getAllocationsCount());
+}
+
+TEST_F(ScratchSpacePoolTest, givenControllerNotUsingScratchForEnoughTasksWhenIdleScratchSpaceIsReleasedThenAllocationReturnsToPool) {
+    DebugManager.flags.ScratchSpaceIdleTaskCountBeforeRelease.set(2);
+    auto controller = createController();
+    auto scratchSpacePool = controller->peekScratchSpacePool();
+
+    requireScratch(*controller, 0x1000, 1u);
+    auto scratchAllocation = controller->getScratchSpaceAllocation();
+
+    controller->releaseIdleScratchSpace(2u);
+    EXPECT_EQ(scratchAllocation, controller->getScratchSpaceAllocation());
+
+    controller->releaseIdleScratchSpace(3u);
+    EXPECT_EQ(nullptr, controller->getScratchSpaceAllocation());
+    EXPECT_EQ(1u, scratchSpacePool->getCachedAllocationsCount());
+
+    vfeStateDirty = false;
+    requireScratch(*controller, 0x1000, 4u);
+    EXPECT_EQ(scratchAllocation, controller->getScratchSpaceAllocation());
+    EXPECT_TRUE(vfeStateDirty);
+}
+
+TEST_F(ScratchSpaceControllerTest, givenScratchSpacePoolDisabledWhenIdleScratchSpaceIsReleasedThenAllocationIsKept) {
+    MockScratchSpaceController scratchSpaceController(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(), *pDevice->getGpgpuCommandStreamReceiver().getInternalAllocationStorage());
+    EXPECT_EQ(nullptr, scratchSpaceController.peekScratchSpacePool());
+
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+    scratchSpaceController.setRequiredScratchSpace(nullptr, 0x1000, 0u, 0u, *pDevice->getDefaultEngine().osContext, stateBaseAddressDirty, vfeStateDirty);
+    auto scratchAllocation = scratchSpaceController.getScratchSpaceAllocation();
+    ASSERT_NE(nullptr, scratchAllocation);
+
+    scratchSpaceController.releaseIdleScratchSpace(1000u);
+    EXPECT_EQ(scratchAllocation, scratchSpaceController.getScratchSpaceAllocation());
+}
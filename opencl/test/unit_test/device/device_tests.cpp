@@ -197,6 +197,37 @@ TEST(DeviceCreation, givenDeviceWhenItIsCreatedThenOsContextIsRegistredInMemoryM
     EXPECT_EQ(numEnginesForDevice, memoryManager->getRegisteredEnginesCount());
 }
 
+TEST(DeviceCreation, givenLazyEngineCreationWhenDeviceIsCreatedThenOnlyDefaultEngineIsCreatedAndOtherEnginesAreCreatedOnFirstUse) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableLazyEngineCreation.set(1);
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    if (device->getNumAvailableDevices() > 1) {
+        GTEST_SKIP();
+    }
+    auto memoryManager = device->getMemoryManager();
+    auto &hwInfo = device->getHardwareInfo();
+    auto gpgpuEngines = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getGpgpuEngineInstances(hwInfo);
+
+    EXPECT_EQ(1u, memoryManager->getRegisteredEnginesCount());
+    EXPECT_EQ(gpgpuEngines.size(), device->engines.size());
+    EXPECT_NE(nullptr, device->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(nullptr, device->engines[HwHelper::lowPriorityGpgpuEngineIndex].commandStreamReceiver);
+
+    auto &lowPriorityEngine = device->getEngine(gpgpuEngines[HwHelper::lowPriorityGpgpuEngineIndex], true);
+    EXPECT_NE(nullptr, lowPriorityEngine.commandStreamReceiver);
+    EXPECT_TRUE(lowPriorityEngine.osContext->isLowPriority());
+    EXPECT_EQ(2u, memoryManager->getRegisteredEnginesCount());
+
+    EXPECT_EQ(&lowPriorityEngine, &device->getEngine(gpgpuEngines[HwHelper::lowPriorityGpgpuEngineIndex], true));
+    EXPECT_EQ(2u, memoryManager->getRegisteredEnginesCount());
+
+    auto &internalEngine = device->getInternalEngine();
+    EXPECT_NE(nullptr, internalEngine.commandStreamReceiver);
+    EXPECT_EQ(&device->engines[HwHelper::internalUsageEngineIndex], &internalEngine);
+    EXPECT_EQ(3u, memoryManager->getRegisteredEnginesCount());
+}
+
 TEST(DeviceCreation, givenMultiRootDeviceWhenTheyAreCreatedThenEachOsContextHasUniqueId) {
     ExecutionEnvironment *executionEnvironment = platform()->peekExecutionEnvironment();
     const size_t numDevices = 2;
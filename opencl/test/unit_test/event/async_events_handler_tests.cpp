@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
@@ -13,6 +14,9 @@
 #include "opencl/source/event/user_event.h"
 #include "opencl/source/platform/platform.h"
 #include "opencl/test/unit_test/mocks/mock_async_event_handler.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_device.h"
 #include "test.h"
 
 #include "gmock/gmock.h"
@@ -368,3 +372,70 @@ TEST_F(AsyncEventsHandlerTests, WhenReturningThenAsyncProcessWillCallProcessList
 
     event->release();
 }
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsOnCsrWhenListIsProcessedThenRetireAllEventsBelowCompletionWatermarkAndSkipOthers) {
+    struct CountingEvent : public Event {
+        CountingEvent(CommandQueue *cmdQueue, uint32_t taskCount) : Event(cmdQueue, CL_COMMAND_NDRANGE_KERNEL, 0, taskCount) {}
+        void updateExecutionStatus() override {
+            ++updateCount;
+            Event::updateExecutionStatus();
+        }
+        uint32_t updateCount = 0;
+    };
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+    MockCommandQueue cmdQ(&context, device.get(), 0);
+    auto &csr = cmdQ.getGpgpuCommandStreamReceiver();
+    *csr.getTagAddress() = 0;
+
+    int callbackCounters[3] = {};
+    CountingEvent *events[3] = {new CountingEvent(&cmdQ, 3), new CountingEvent(&cmdQ, 5), new CountingEvent(&cmdQ, 7)};
+    for (int i = 0; i < 3; i++) {
+        events[i]->addCallback(&this->callbackFcn, CL_COMPLETE, &callbackCounters[i]);
+        handler->registerEvent(events[i]);
+    }
+
+    EXPECT_EQ(events[0], handler->process());
+    for (auto event : events) {
+        EXPECT_EQ(CL_SUBMITTED, event->peekExecutionStatus());
+    }
+
+    *csr.getTagAddress() = 5;
+    auto updateCountBeforeRetire = events[2]->updateCount;
+    EXPECT_EQ(events[2], handler->process());
+    EXPECT_EQ(1, callbackCounters[0]);
+    EXPECT_EQ(1, callbackCounters[1]);
+    EXPECT_EQ(0, callbackCounters[2]);
+    EXPECT_EQ(updateCountBeforeRetire, events[2]->updateCount);
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *csr.getTagAddress() = 7;
+    EXPECT_EQ(nullptr, handler->process());
+    EXPECT_EQ(1, callbackCounters[2]);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+
+    for (auto event : events) {
+        event->release();
+    }
+}
+
+TEST_F(AsyncEventsHandlerTests, givenOnlyBlockedEventsWhenAsyncThreadIsProcessingThenEventsAreRetiredAfterUnblock) {
+    handler->allowThreadCreating = true;
+    event1->addCallback(&this->callbackFcn, CL_SUBMITTED, &counter);
+    handler->registerEvent(event1);
+
+    // blocked event doesn't have task count to wait for, thread has to keep polling
+    while (handler->transferCounter < 2) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(CL_QUEUED, event1->getExecutionStatus());
+
+    event1->taskLevel.store(0);
+    while (event1->getExecutionStatus() == CL_QUEUED) {
+        std::this_thread::yield();
+    }
+    handler->closeThread();
+    EXPECT_EQ(CL_SUBMITTED, event1->getExecutionStatus());
+    EXPECT_EQ(1, counter);
+}
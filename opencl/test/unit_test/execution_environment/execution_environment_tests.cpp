@@ -7,6 +7,7 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/execution_environment.h"
@@ -27,6 +28,8 @@
 #include "opencl/test/unit_test/mocks/mock_memory_operations_handler.h"
 #include "test.h"
 
+#include <thread>
+
 using namespace NEO;
 
 TEST(ExecutionEnvironment, givenDefaultConstructorWhenItIsCalledThenExecutionEnvironmentHasInitialRefCountZero) {
@@ -245,3 +248,22 @@ TEST(RootDeviceEnvironment, whenGetHardwareInfoIsCalledThenHardwareInfoIsTakenFr
     RootDeviceEnvironment rootDeviceEnvironment(executionEnvironment);
     EXPECT_EQ(rootDeviceEnvironment.getHardwareInfo(), executionEnvironment.getHardwareInfo());
 }
+
+TEST(RootDeviceEnvironment, givenManyThreadsWhenScratchSpacePoolIsQueriedThenAllThreadsGetTheSamePool) {
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(*platformDevices));
+    auto rootDeviceEnvironment = device->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+
+    ScratchSpacePool *pools[4] = {};
+    std::vector<std::thread> threads;
+    for (auto &pool : pools) {
+        threads.emplace_back([&]() { pool = rootDeviceEnvironment->getScratchSpacePool(0u); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_NE(nullptr, pools[0]);
+    for (auto pool : pools) {
+        EXPECT_EQ(pools[0], pool);
+    }
+}
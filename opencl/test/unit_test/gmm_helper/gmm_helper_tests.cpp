@@ -7,6 +7,8 @@
 
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/gmm_helper/image_resource_cache.h"
+#include "shared/source/gmm_helper/resource_info.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/device_factory.h"
@@ -250,6 +252,126 @@ TEST_F(GmmTests, given2DimageFromBufferParametersWhenGmmResourceIsCreatedAndPitc
     EXPECT_EQ(imgDesc.image_row_pitch, queryGmm->gmmResourceInfo->getRenderPitch());
 }
 
+struct ImageResourceCacheTests : public GmmTests {
+    void SetUp() override {
+        GmmTests::SetUp();
+        DebugManager.flags.EnableImageResourceCache.set(1);
+        clientContext = rootDeviceEnvironment->getGmmClientContext();
+        clientContext->getImageResourceCache().clear();
+    }
+    void TearDown() override {
+        clientContext->getImageResourceCache().clear();
+    }
+
+    DebugManagerStateRestore restorer;
+    GmmClientContext *clientContext = nullptr;
+};
+
+TEST_F(ImageResourceCacheTests, givenImageResourceCacheEnabledWhenGmmIsCreatedForIdenticalImageThenCachedParamsAreUsed) {
+    cl_image_desc imgDesc{};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE3D;
+    imgDesc.image_width = 17;
+    imgDesc.image_height = 17;
+    imgDesc.image_depth = 17;
+    auto &imageResourceCache = clientContext->getImageResourceCache();
+
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto queryGmm = MockGmm::queryImgParams(clientContext, imgInfo);
+    EXPECT_EQ(1u, imageResourceCache.getEntriesCount());
+    EXPECT_EQ(1u, imageResourceCache.getMissesCount());
+    EXPECT_EQ(0u, imageResourceCache.getHitsCount());
+
+    auto cachedImgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto cachedGmm = MockGmm::queryImgParams(clientContext, cachedImgInfo);
+    EXPECT_EQ(1u, imageResourceCache.getEntriesCount());
+    EXPECT_EQ(1u, imageResourceCache.getHitsCount());
+
+    EXPECT_EQ(imgInfo.size, cachedImgInfo.size);
+    EXPECT_EQ(imgInfo.rowPitch, cachedImgInfo.rowPitch);
+    EXPECT_EQ(imgInfo.slicePitch, cachedImgInfo.slicePitch);
+    EXPECT_EQ(imgInfo.qPitch, cachedImgInfo.qPitch);
+    EXPECT_EQ(queryGmm->resourceParams.Type, cachedGmm->resourceParams.Type);
+    EXPECT_EQ(queryGmm->resourceParams.BaseWidth64, cachedGmm->resourceParams.BaseWidth64);
+    EXPECT_EQ(queryGmm->resourceParams.Depth, cachedGmm->resourceParams.Depth);
+    ASSERT_NE(nullptr, cachedGmm->gmmResourceInfo);
+    EXPECT_NE(queryGmm->gmmResourceInfo.get(), cachedGmm->gmmResourceInfo.get());
+    EXPECT_EQ(queryGmm->gmmResourceInfo->getSizeAllocation(), cachedGmm->gmmResourceInfo->getSizeAllocation());
+}
+
+TEST_F(ImageResourceCacheTests, givenImageResourceCacheEnabledWhenGmmIsCreatedForDifferentImagesThenGmmLibIsQueriedForEach) {
+    cl_image_desc imgDesc{};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 16;
+    imgDesc.image_height = 16;
+    auto &imageResourceCache = clientContext->getImageResourceCache();
+
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    MockGmm::queryImgParams(clientContext, imgInfo);
+
+    imgDesc.image_height = 32;
+    auto secondImgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    MockGmm::queryImgParams(clientContext, secondImgInfo);
+
+    auto linearImgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    linearImgInfo.linearStorage = !secondImgInfo.linearStorage;
+    MockGmm::queryImgParams(clientContext, linearImgInfo);
+
+    EXPECT_EQ(3u, imageResourceCache.getEntriesCount());
+    EXPECT_EQ(3u, imageResourceCache.getMissesCount());
+    EXPECT_EQ(0u, imageResourceCache.getHitsCount());
+    EXPECT_NE(imgInfo.size, secondImgInfo.size);
+}
+
+TEST_F(ImageResourceCacheTests, givenImageResourceCacheDisabledWhenGmmIsCreatedThenNothingIsCached) {
+    DebugManager.flags.EnableImageResourceCache.set(0);
+    cl_image_desc imgDesc{};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 16;
+    imgDesc.image_height = 16;
+
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    MockGmm::queryImgParams(clientContext, imgInfo);
+    EXPECT_EQ(0u, clientContext->getImageResourceCache().getEntriesCount());
+}
+
+TEST(ImageResourceCacheTest, givenMaxEntriesReachedWhenNewEntryIsStoredThenLeastRecentlyUsedEntryIsEvicted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableImageResourceCache.set(1);
+    DebugManager.flags.ImageResourceCacheMaxEntries.set(2);
+    auto clientContext = platform()->peekExecutionEnvironment()->rootDeviceEnvironments[0]->getGmmClientContext();
+    ImageResourceCache imageResourceCache;
+
+    cl_image_desc imgDesc{};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 16;
+    imgDesc.image_height = 16;
+    ImageInfo imgInfos[3];
+    ImageResourceCache::Key keys[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        imgDesc.image_height = 16 * (i + 1);
+        imgInfos[i] = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+        keys[i] = ImageResourceCache::createKey(imgInfos[i], 0u);
+    }
+
+    auto gmm0 = MockGmm::queryImgParams(clientContext, imgInfos[0]);
+    imageResourceCache.store(keys[0], clientContext, *gmm0, imgInfos[0]);
+    auto gmm1 = MockGmm::queryImgParams(clientContext, imgInfos[1]);
+    imageResourceCache.store(keys[1], clientContext, *gmm1, imgInfos[1]);
+
+    auto restoredInfo = imgInfos[0];
+    auto restoredGmm = MockGmm::queryImgParams(clientContext, restoredInfo);
+    EXPECT_TRUE(imageResourceCache.restore(keys[0], clientContext, *restoredGmm, restoredInfo));
+
+    auto gmm2 = MockGmm::queryImgParams(clientContext, imgInfos[2]);
+    imageResourceCache.store(keys[2], clientContext, *gmm2, imgInfos[2]);
+    EXPECT_EQ(2u, imageResourceCache.getEntriesCount());
+
+    EXPECT_TRUE(imageResourceCache.restore(keys[0], clientContext, *restoredGmm, restoredInfo));
+    EXPECT_FALSE(imageResourceCache.restore(keys[1], clientContext, *restoredGmm, restoredInfo));
+    EXPECT_TRUE(imageResourceCache.restore(keys[2], clientContext, *restoredGmm, restoredInfo));
+    clientContext->getImageResourceCache().clear();
+}
+
 TEST_F(GmmTests, givenPlanarFormatsWhenQueryingImageParamsThenUvOffsetIsQueried) {
     cl_image_desc imgDesc{};
     imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
@@ -1483,6 +1483,84 @@ TEST_F(TimestampPacketTests, givenDispatchSizeWhenAskingForNewTimestampsThenObta
     EXPECT_EQ(dispatchSize, mockCmdQ->timestampPacketContainer->peekNodes().size());
 }
 
+TEST_F(TimestampPacketTests, givenInOrderDependenciesWhenObtainingNewTimestampsThenNodesAreOrderedOnQueueTimeline) {
+    mockCmdQ->timestampPacketContainer = std::make_unique<MockTimestampPacketContainer>(*device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator(), 0);
+
+    TimestampPacketContainer previousNodes;
+    mockCmdQ->obtainNewTimestampPacketNodes(2, previousNodes, false);
+    auto firstNode = mockCmdQ->timestampPacketContainer->peekNodes()[0];
+    auto timelineId = firstNode->getTimelineId();
+    auto sequence = firstNode->getTimelineSequence();
+    EXPECT_NE(0u, timelineId);
+    EXPECT_EQ(timelineId, mockCmdQ->timestampPacketContainer->peekNodes()[1]->getTimelineId());
+    EXPECT_EQ(sequence, mockCmdQ->timestampPacketContainer->peekNodes()[1]->getTimelineSequence());
+
+    TimestampPacketContainer previousNodes2;
+    mockCmdQ->obtainNewTimestampPacketNodes(1, previousNodes2, false);
+    EXPECT_EQ(timelineId, mockCmdQ->timestampPacketContainer->peekNodes()[0]->getTimelineId());
+    EXPECT_LT(sequence, mockCmdQ->timestampPacketContainer->peekNodes()[0]->getTimelineSequence());
+
+    TimestampPacketContainer previousNodes3;
+    mockCmdQ->obtainNewTimestampPacketNodes(1, previousNodes3, true);
+    EXPECT_NE(timelineId, mockCmdQ->timestampPacketContainer->peekNodes()[0]->getTimelineId());
+}
+
+HWTEST_F(TimestampPacketTests, givenCompletedDuplicatedAndImpliedNodesWhenProgrammingCsrDependenciesThenSemaphoresAreProgrammedOnlyForRemainingNodes) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    auto allocator = device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
+
+    MockTimestampPacketContainer timestamp1(*allocator, 2);
+    MockTimestampPacketContainer timestamp2(*allocator, 3);
+    setTagToReadyState(timestamp1.getNode(0));
+    timestamp2.add(timestamp1.getNode(1));
+    timestamp1.getNode(1)->incRefCount();
+    timestamp2.getNode(0)->setTimeline(5u, 1u);
+    timestamp2.getNode(1)->setTimeline(5u, 2u);
+    timestamp2.getNode(2)->setTimeline(6u, 1u);
+
+    CsrDependencies csrDeps;
+    csrDeps.push_back(&timestamp1);
+    csrDeps.push_back(&timestamp2);
+
+    auto elidedCountBefore = TimestampPacketHelper::getElidedDependenciesCount();
+    auto &cmdStream = mockCmdQ->getCS(0);
+    TimestampPacketHelper::programCsrDependencies<FamilyType>(cmdStream, csrDeps);
+    EXPECT_EQ(cmdStream.getUsed(), TimestampPacketHelper::getRequiredCmdStreamSize<FamilyType>(csrDeps));
+    EXPECT_EQ(elidedCountBefore + 3u, TimestampPacketHelper::getElidedDependenciesCount());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdStream, 0);
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_EQ(3u, semaphores.size());
+    verifySemaphore(genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[0]), timestamp1.getNode(1), 0);
+    verifySemaphore(genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[1]), timestamp2.getNode(1), 0);
+    verifySemaphore(genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[2]), timestamp2.getNode(2), 0);
+}
+
+HWTEST_F(TimestampPacketTests, givenDependencyPruningDisabledWhenProgrammingCsrDependenciesThenSemaphoreIsProgrammedForEachNode) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableTimestampPacketDependencyPruning.set(0);
+    auto allocator = device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
+
+    MockTimestampPacketContainer timestamp(*allocator, 2);
+    setTagToReadyState(timestamp.getNode(0));
+    timestamp.getNode(0)->setTimeline(5u, 1u);
+    timestamp.getNode(1)->setTimeline(5u, 2u);
+
+    CsrDependencies csrDeps;
+    csrDeps.push_back(&timestamp);
+
+    auto &cmdStream = mockCmdQ->getCS(0);
+    TimestampPacketHelper::programCsrDependencies<FamilyType>(cmdStream, csrDeps);
+    EXPECT_EQ(cmdStream.getUsed(), TimestampPacketHelper::getRequiredCmdStreamSize<FamilyType>(csrDeps));
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdStream, 0);
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    EXPECT_EQ(2u, semaphores.size());
+}
+
 HWTEST_F(TimestampPacketTests, givenWaitlistAndOutputEventWhenEnqueueingWithoutKernelThenInheritTimestampPacketsWithoutSubmitting) {
     device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
 
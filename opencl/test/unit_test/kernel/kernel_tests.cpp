@@ -1907,6 +1907,31 @@ HWTEST_F(KernelResidencyTest, givenSharedUnifiedMemoryRequiredMemSyncWhenMakeRes
     svmAllocationsManager->freeSVMAlloc(unifiedMemoryAllocation);
 }
 
+HWTEST_F(KernelResidencyTest, givenSharedUnifiedMemoryAllocPassedAsSvmExecInfoWhenMakeResidentIsCalledThenOnlyThisAllocationIsDecommited) {
+    auto mockPageFaultManager = new MockPageFaultManager();
+    static_cast<MockMemoryManager *>(this->pDevice->getExecutionEnvironment()->memoryManager.get())->pageFaultManager.reset(mockPageFaultManager);
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto svmAllocationsManager = mockKernel.mockContext->getSVMAllocsManager();
+    auto usedAllocation = svmAllocationsManager->createSharedUnifiedMemoryAllocation(pDevice->getRootDeviceIndex(), 4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY), mockKernel.mockContext->getSpecialQueue());
+    auto unusedAllocation = svmAllocationsManager->createSharedUnifiedMemoryAllocation(pDevice->getRootDeviceIndex(), 4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY), mockKernel.mockContext->getSpecialQueue());
+    mockPageFaultManager->insertAllocation(usedAllocation, 4096u, svmAllocationsManager, mockKernel.mockContext->getSpecialQueue());
+    mockPageFaultManager->insertAllocation(unusedAllocation, 4096u, svmAllocationsManager, mockKernel.mockContext->getSpecialQueue());
+
+    mockKernel.mockKernel->setSvmKernelExecInfo(svmAllocationsManager->getSVMAlloc(usedAllocation)->gpuAllocation);
+
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+
+    EXPECT_EQ(mockPageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(mockPageFaultManager->transferToGpuAddress, usedAllocation);
+    EXPECT_FALSE(mockPageFaultManager->memoryData[unusedAllocation].isInGpuDomain);
+
+    mockKernel.mockKernel->clearSvmKernelExecInfo();
+    svmAllocationsManager->freeSVMAlloc(usedAllocation);
+    svmAllocationsManager->freeSVMAlloc(unusedAllocation);
+}
+
 HWTEST_F(KernelResidencyTest, givenSharedUnifiedMemoryAllocPageFaultManagerAndIndirectAllocsAllowedWhenMakeResidentIsCalledThenAllocationIsDecommited) {
     auto mockPageFaultManager = new MockPageFaultManager();
     static_cast<MockMemoryManager *>(this->pDevice->getExecutionEnvironment()->memoryManager.get())->pageFaultManager.reset(mockPageFaultManager);
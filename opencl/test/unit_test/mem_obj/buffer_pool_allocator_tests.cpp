@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/host_ptr_manager.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/mem_obj/buffer.h"
+#include "opencl/source/mem_obj/buffer_pool_allocator.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <memory>
+
+using namespace NEO;
+
+class BufferPoolAllocatorTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        DebugManager.flags.EnableSmallBufferPool.set(1);
+        context = std::make_unique<MockContext>();
+        context->smallBufferPoolAllocator = std::make_unique<BufferPoolAllocator>(*context);
+        poolAllocator = context->getBufferPoolAllocator();
+    }
+
+    std::unique_ptr<Buffer> createBuffer(cl_mem_flags flags, size_t size, void *hostPtr = nullptr) {
+        return std::unique_ptr<Buffer>(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockContext> context;
+    BufferPoolAllocator *poolAllocator = nullptr;
+    cl_int retVal = CL_SUCCESS;
+};
+
+TEST(BufferPoolAllocator, givenDefaultSettingsWhenContextIsCreatedThenSmallBufferPoolIsNotUsed) {
+    MockContext context;
+    EXPECT_FALSE(BufferPoolAllocator::isAggregationEnabled());
+    EXPECT_EQ(nullptr, context.getBufferPoolAllocator());
+}
+
+TEST_F(BufferPoolAllocatorTest, givenSmallBuffersWhenTheyAreCreatedThenTheyShareSinglePoolAllocationWithDifferentOffsets) {
+    auto buffer1 = createBuffer(CL_MEM_READ_WRITE, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, buffer1);
+    auto buffer2 = createBuffer(CL_MEM_READ_WRITE, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, buffer2);
+
+    EXPECT_TRUE(buffer1->isPooledBuffer());
+    EXPECT_TRUE(buffer2->isPooledBuffer());
+    EXPECT_TRUE(buffer1->isMemObjZeroCopy());
+    EXPECT_EQ(buffer1->getGraphicsAllocation(), buffer2->getGraphicsAllocation());
+    EXPECT_NE(buffer1->getOffset(), buffer2->getOffset());
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+
+    auto poolStorage = buffer2->getGraphicsAllocation();
+    EXPECT_EQ(ptrOffset(poolStorage->getUnderlyingBuffer(), buffer2->getOffset()), buffer2->getCpuAddress());
+
+    size_t clOffset = 1u;
+    retVal = buffer2->getMemObjectInfo(CL_MEM_OFFSET, sizeof(clOffset), &clOffset, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, clOffset);
+}
+
+TEST_F(BufferPoolAllocatorTest, givenBufferBiggerThanPoolThresholdWhenItIsCreatedThenItIsNotPooled) {
+    auto buffer = createBuffer(CL_MEM_READ_WRITE, poolAllocator->getMaxBufferSize() + 1);
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_FALSE(buffer->isPooledBuffer());
+    EXPECT_EQ(0u, buffer->getOffset());
+    EXPECT_EQ(0u, poolAllocator->getPoolsCount());
+}
+
+TEST_F(BufferPoolAllocatorTest, givenUseHostPtrFlagWhenBufferIsCreatedThenItIsNotPooled) {
+    alignas(MemoryConstants::pageSize) uint8_t hostPtr[MemoryConstants::pageSize] = {};
+    auto buffer = createBuffer(CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, sizeof(hostPtr), hostPtr);
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_FALSE(buffer->isPooledBuffer());
+}
+
+TEST_F(BufferPoolAllocatorTest, givenCopyHostPtrFlagWhenPooledBufferIsCreatedThenDataIsCopiedToPoolStorage) {
+    uint8_t hostPtr[256];
+    for (size_t i = 0; i < sizeof(hostPtr); i++) {
+        hostPtr[i] = static_cast<uint8_t>(i);
+    }
+    auto buffer = createBuffer(CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, sizeof(hostPtr), hostPtr);
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_TRUE(buffer->isPooledBuffer());
+
+    auto storage = ptrOffset(buffer->getGraphicsAllocation()->getUnderlyingBuffer(), buffer->getOffset());
+    EXPECT_EQ(0, memcmp(hostPtr, storage, sizeof(hostPtr)));
+}
+
+TEST_F(BufferPoolAllocatorTest, givenReleasedPooledBufferWhenPoolIsExhaustedThenReleasedChunkIsReused) {
+    DebugManager.flags.SmallBufferPoolMaxBufferSize.set(static_cast<int32_t>(BufferPoolAllocator::poolSize / 2));
+    context->smallBufferPoolAllocator = std::make_unique<BufferPoolAllocator>(*context);
+    poolAllocator = context->getBufferPoolAllocator();
+    constexpr size_t bufferSize = BufferPoolAllocator::poolSize / 2;
+
+    auto buffer1 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    auto buffer2 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    ASSERT_NE(nullptr, buffer1);
+    ASSERT_NE(nullptr, buffer2);
+    ASSERT_TRUE(buffer2->isPooledBuffer());
+
+    auto poolStorage = buffer1->getGraphicsAllocation();
+    auto releasedOffset = buffer1->getOffset();
+    buffer1.reset();
+
+    auto buffer3 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    ASSERT_NE(nullptr, buffer3);
+    EXPECT_TRUE(buffer3->isPooledBuffer());
+    EXPECT_EQ(poolStorage, buffer3->getGraphicsAllocation());
+    EXPECT_EQ(releasedOffset, buffer3->getOffset());
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+}
+
+TEST_F(BufferPoolAllocatorTest, givenPooledBufferWhenSubBufferIsCreatedThenItsOffsetIncludesOffsetInPool) {
+    auto buffer1 = createBuffer(CL_MEM_READ_WRITE, MemoryConstants::pageSize);
+    auto buffer2 = createBuffer(CL_MEM_READ_WRITE, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, buffer2);
+    ASSERT_NE(0u, buffer2->getOffset());
+
+    cl_buffer_region region = {MemoryConstants::cacheLineSize, MemoryConstants::cacheLineSize};
+    auto subBuffer = std::unique_ptr<Buffer>(buffer2->createSubBuffer(CL_MEM_READ_WRITE, 0, &region, retVal));
+    ASSERT_NE(nullptr, subBuffer);
+    EXPECT_FALSE(subBuffer->isPooledBuffer());
+    EXPECT_EQ(buffer2->getGraphicsAllocation(), subBuffer->getGraphicsAllocation());
+    EXPECT_EQ(buffer2->getOffset() + region.origin, subBuffer->getOffset());
+
+    size_t clOffset = 0u;
+    retVal = subBuffer->getMemObjectInfo(CL_MEM_OFFSET, sizeof(clOffset), &clOffset, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(region.origin, clOffset);
+}
+
+TEST_F(BufferPoolAllocatorTest, givenPooledBufferWhenSettingKernelArgThenPatchedAddressIncludesOffsetInPool) {
+    auto buffer1 = createBuffer(CL_MEM_READ_WRITE, MemoryConstants::pageSize);
+    auto buffer2 = createBuffer(CL_MEM_READ_WRITE, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, buffer2);
+
+    uint64_t patchedAddress = 0u;
+    buffer2->setArgStateless(&patchedAddress, sizeof(patchedAddress));
+    EXPECT_EQ(buffer2->getGraphicsAllocation()->getGpuAddress() + buffer2->getOffset(), patchedAddress);
+}
+
+TEST_F(BufferPoolAllocatorTest, givenReleasedChunkStillUsedByGpuWhenPoolIsExhaustedThenNewPoolIsAddedAndChunkIsReusedAfterCompletion) {
+    DebugManager.flags.SmallBufferPoolMaxBufferSize.set(static_cast<int32_t>(BufferPoolAllocator::poolSize / 2));
+    context->smallBufferPoolAllocator = std::make_unique<BufferPoolAllocator>(*context);
+    poolAllocator = context->getBufferPoolAllocator();
+    constexpr size_t bufferSize = BufferPoolAllocator::poolSize / 2;
+
+    auto buffer1 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    auto buffer2 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    ASSERT_NE(nullptr, buffer1);
+    ASSERT_NE(nullptr, buffer2);
+    ASSERT_TRUE(buffer2->isPooledBuffer());
+
+    auto &engine = context->getDevice(0)->getDefaultEngine();
+    auto tagAddress = engine.commandStreamReceiver->getTagAddress();
+    auto initialTag = *tagAddress;
+    *tagAddress = 5u;
+
+    auto poolStorage = buffer1->getGraphicsAllocation();
+    auto releasedOffset = buffer1->getOffset();
+    poolStorage->updateTaskCount(10u, engine.osContext->getContextId());
+    buffer1.reset();
+
+    auto buffer3 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    ASSERT_NE(nullptr, buffer3);
+    EXPECT_TRUE(buffer3->isPooledBuffer());
+    EXPECT_NE(poolStorage, buffer3->getGraphicsAllocation());
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount());
+
+    *tagAddress = 10u;
+    auto buffer4 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    ASSERT_NE(nullptr, buffer4);
+    EXPECT_EQ(poolStorage, buffer4->getGraphicsAllocation());
+    EXPECT_EQ(releasedOffset, buffer4->getOffset());
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount());
+
+    buffer2.reset();
+    buffer3.reset();
+    buffer4.reset();
+    context->smallBufferPoolAllocator.reset();
+    *tagAddress = initialTag;
+}
+
+TEST_F(BufferPoolAllocatorTest, givenPooledBufferWhenItIsCreatedThenPoolStorageIsNotRegisteredAsHostMemory) {
+    auto buffer = createBuffer(CL_MEM_READ_WRITE, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_TRUE(buffer->isPooledBuffer());
+
+    auto hostPtrManager = context->getMemoryManager()->getHostPtrManager();
+    EXPECT_EQ(nullptr, hostPtrManager->getFragment(buffer->getGraphicsAllocation()->getUnderlyingBuffer()));
+}
+
+TEST_F(BufferPoolAllocatorTest, givenIdlePoolsWhenLastChunkOfPoolIsReleasedThenOnlyAllowedNumberOfIdlePoolsIsKept) {
+    DebugManager.flags.SmallBufferPoolMaxBufferSize.set(static_cast<int32_t>(BufferPoolAllocator::poolSize));
+    context->smallBufferPoolAllocator = std::make_unique<BufferPoolAllocator>(*context);
+    poolAllocator = context->getBufferPoolAllocator();
+    constexpr size_t bufferSize = BufferPoolAllocator::poolSize;
+
+    auto buffer1 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    auto buffer2 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    auto buffer3 = createBuffer(CL_MEM_READ_WRITE, bufferSize);
+    ASSERT_NE(nullptr, buffer3);
+    ASSERT_TRUE(buffer3->isPooledBuffer());
+    EXPECT_EQ(3u, poolAllocator->getPoolsCount());
+
+    buffer1.reset();
+    EXPECT_EQ(3u, poolAllocator->getPoolsCount());
+    buffer2.reset();
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount());
+    buffer3.reset();
+    EXPECT_EQ(BufferPoolAllocator::maxIdlePoolsCount, poolAllocator->getPoolsCount());
+}
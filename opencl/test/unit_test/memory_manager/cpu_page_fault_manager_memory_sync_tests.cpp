@@ -5,16 +5,20 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/test/unit_test/page_fault_manager/cpu_page_fault_manager_tests_fixture.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
 
 #include "gtest/gtest.h"
 
 using namespace NEO;
 
 struct CommandQueueMock : public MockCommandQueue {
+    using MockCommandQueue::MockCommandQueue;
+
     cl_int enqueueSVMUnmap(void *svmPtr,
                            cl_uint numEventsInWaitList, const cl_event *eventWaitList,
                            cl_event *event, bool externalAppCall) override {
@@ -54,3 +58,36 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSynchronizeMemoryThenEnq
     EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
     EXPECT_EQ(cmdQ->finishCalled, 1);
 }
+
+TEST_F(PageFaultManagerTest, givenManyChunksWhenTransferredToGpuThenEachChunkIsUnmappedAndQueueIsFinishedOnce) {
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    auto cmdQ = std::make_unique<CommandQueueMock>();
+    std::vector<void *> chunkPtrs = {alloc, ptrOffset(alloc, 0x1000), ptrOffset(alloc, 0x3000)};
+
+    pageFaultManager->baseChunksGpuTransfer(chunkPtrs, {}, cmdQ.get());
+    EXPECT_EQ(cmdQ->transferToCpuCalled, 0);
+    EXPECT_EQ(cmdQ->transferToGpuCalled, 3);
+    EXPECT_EQ(cmdQ->finishCalled, 1);
+}
+
+TEST_F(PageFaultManagerTest, givenDirtyChunkMappedForReadWhenTransferredToGpuThenOnlyDirtyChunkIsRemappedForWriteBeforeUnmap) {
+    MockContext context;
+    auto cmdQ = std::make_unique<CommandQueueMock>(context);
+    auto svmAllocsManager = context.getSVMAllocsManager();
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    auto cleanChunk = alloc;
+    auto dirtyChunk = ptrOffset(alloc, 0x1000);
+    svmAllocsManager->insertSvmMapOperation(cleanChunk, 0x1000, alloc, 0, true);
+    svmAllocsManager->insertSvmMapOperation(dirtyChunk, 0x1000, alloc, 0x1000, true);
+
+    pageFaultManager->baseChunksGpuTransfer({cleanChunk}, {dirtyChunk}, cmdQ.get());
+    EXPECT_EQ(cmdQ->transferToGpuCalled, 2);
+    EXPECT_EQ(cmdQ->finishCalled, 1);
+    EXPECT_TRUE(svmAllocsManager->getSvmMapOperation(cleanChunk)->readOnlyMap);
+    auto dirtyChunkOperation = svmAllocsManager->getSvmMapOperation(dirtyChunk);
+    ASSERT_NE(nullptr, dirtyChunkOperation);
+    EXPECT_FALSE(dirtyChunkOperation->readOnlyMap);
+    EXPECT_EQ(0x1000u, dirtyChunkOperation->regionSize);
+    EXPECT_EQ(alloc, dirtyChunkOperation->baseSvmPtr);
+    EXPECT_EQ(0x1000u, dirtyChunkOperation->offset);
+}
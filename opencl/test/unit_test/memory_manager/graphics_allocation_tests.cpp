@@ -171,6 +171,7 @@ TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenQueryingUsedPageSizeThen
 
     MemoryPool::Type page64kPools[] = {MemoryPool::System64KBPages,
                                        MemoryPool::System64KBPagesWith32BitGpuAddressing,
+                                       MemoryPool::System2MBPages,
                                        MemoryPool::LocalMemory};
 
     for (auto pool : page64kPools) {
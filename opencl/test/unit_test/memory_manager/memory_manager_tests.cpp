@@ -794,6 +794,29 @@ TEST(OsAgnosticMemoryManager, givenMemoryManagerWhenAllocateGraphicsMemoryIsCall
     memoryManager.freeGraphicsMemory(allocation);
 }
 
+TEST(OsAgnosticMemoryManager, givenHugePageAllocationsEnabledWhenAllocatingAboveThresholdThenMemoryIs2MBAlignedAndPoolIsSystem2MBPages) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableHugePageAllocations.set(1);
+    DebugManager.flags.HugePageAllocationThresholdInKb.set(1024);
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    MemoryManagerCreate<OsAgnosticMemoryManager> memoryManager(false, false, executionEnvironment);
+
+    EXPECT_FALSE(memoryManager.isHugePageAllocationPreferred(MemoryConstants::megaByte - MemoryConstants::pageSize));
+    EXPECT_TRUE(memoryManager.isHugePageAllocationPreferred(MemoryConstants::megaByte));
+
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryPool::System4KBPages, allocation->getMemoryPool());
+    memoryManager.freeGraphicsMemory(allocation);
+
+    allocation = memoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::megaByte + MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryPool::System2MBPages, allocation->getMemoryPool());
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2Mb>(allocation->getUnderlyingBuffer()));
+    EXPECT_EQ(MemoryConstants::pageSize64k, allocation->getUsedPageSize());
+    memoryManager.freeGraphicsMemory(allocation);
+}
+
 TEST(OsAgnosticMemoryManager, givenMemoryManagerWith64KBPagesEnabledWhenAllocateGraphicsMemory64kbIsCalledThenMemoryPoolIsSystem64KBPages) {
     MockExecutionEnvironment executionEnvironment(*platformDevices);
     executionEnvironment.initGmm();
@@ -1718,6 +1741,47 @@ TEST(ResidencyDataTest, givenTwoOsContextsWhenTheyAreRegisteredFromHigherToLower
     EXPECT_EQ(1, memoryManager->registeredEngines[1].osContext->getRefInternalCount());
 }
 
+TEST(MemoryManagerRegisteredEnginesTest, givenLazyEngineCreationDisabledWhenSnapshotOfRegisteredEnginesIsTakenThenRegisteredEnginesAreNotCopied) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyEngineCreation.set(0);
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    auto memoryManager = new MockMemoryManager(false, false, executionEnvironment);
+    executionEnvironment.memoryManager.reset(memoryManager);
+    std::unique_ptr<CommandStreamReceiver> csr(createCommandStream(executionEnvironment, 0u));
+    auto &engines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances(*platformDevices[0]);
+    memoryManager->createAndRegisterOsContext(csr.get(), engines[0], 1, PreemptionHelper::getDefaultPreemptionMode(*platformDevices[0]),
+                                              false, false, false);
+
+    auto snapshot = memoryManager->getRegisteredEnginesSnapshot();
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_EQ(memoryManager->getRegisteredEngines().data(), snapshot.begin());
+    EXPECT_EQ(csr.get(), snapshot[0].commandStreamReceiver);
+}
+
+TEST(MemoryManagerRegisteredEnginesTest, givenSnapshotOfRegisteredEnginesWhenNextEngineIsRegisteredThenSnapshotIsNotChanged) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyEngineCreation.set(1);
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    auto memoryManager = new MockMemoryManager(false, false, executionEnvironment);
+    executionEnvironment.memoryManager.reset(memoryManager);
+    std::unique_ptr<CommandStreamReceiver> csr(createCommandStream(executionEnvironment, 0u));
+    std::unique_ptr<CommandStreamReceiver> csr1(createCommandStream(executionEnvironment, 0u));
+    auto &engines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances(*platformDevices[0]);
+    memoryManager->createAndRegisterOsContext(csr.get(), engines[0], 1, PreemptionHelper::getDefaultPreemptionMode(*platformDevices[0]),
+                                              false, false, false);
+
+    auto snapshot = memoryManager->getRegisteredEnginesSnapshot();
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_EQ(csr.get(), snapshot[0].commandStreamReceiver);
+    EXPECT_NE(memoryManager->getRegisteredEngines().data(), snapshot.begin());
+
+    memoryManager->createAndRegisterOsContext(csr1.get(), engines[1], 1, PreemptionHelper::getDefaultPreemptionMode(*platformDevices[0]),
+                                              false, false, false);
+    EXPECT_EQ(1u, snapshot.size());
+    EXPECT_EQ(2u, memoryManager->getRegisteredEnginesSnapshot().size());
+    EXPECT_EQ(2u, memoryManager->getRegisteredEnginesCount());
+}
+
 TEST(ResidencyDataTest, givenGpgpuEnginesWhenAskedForMaxOsContextCountThenValueIsGreaterOrEqual) {
     auto &engines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances(*platformDevices[0]);
     EXPECT_TRUE(MemoryManager::maxOsContextCount >= engines.size());
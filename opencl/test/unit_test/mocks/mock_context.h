@@ -19,6 +19,7 @@ class MockContext : public Context {
     using Context::memoryManager;
     using Context::preferD3dSharedResources;
     using Context::sharingFunctions;
+    using Context::smallBufferPoolAllocator;
     using Context::svmAllocsManager;
     MockContext(ClDevice *device, bool noSpecialQueue = false);
     MockContext(
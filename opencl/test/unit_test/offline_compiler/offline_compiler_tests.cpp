@@ -225,6 +225,86 @@ TEST_F(MultiCommandTests, GoodMultiBuildTestWithOutputFileListFlag) {
     deleteOutFileList();
     delete pMultiCommand;
 }
+TEST_F(MultiCommandTests, GivenJobsCountWhenMultiCommandIsBuiltConcurrentlyThenAllBuildsSucceedAndOutputFileListKeepsCommandsOrder) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "3",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 6;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal);
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+    EXPECT_TRUE(fileExists(outFileList));
+
+    std::ifstream outFileListStream(outFileList);
+    std::string outFileListEntry;
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "gen"));
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+
+        ASSERT_TRUE(static_cast<bool>(std::getline(outFileListStream, outFileListEntry)));
+        std::string expectedEntrySuffix = "/build_no_" + std::to_string(i + 1) + ".bin";
+        ASSERT_LE(expectedEntrySuffix.size(), outFileListEntry.size());
+        EXPECT_EQ(expectedEntrySuffix, outFileListEntry.substr(outFileListEntry.size() - expectedEntrySuffix.size()));
+    }
+    outFileListStream.close();
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+TEST_F(MultiCommandTests, GivenMissingJobsCountWhenMultiCommandIsCreatedThenInvalidCommandLineIsReturned) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-multi",
+        "test_files/ImAMulitiComandMinimalGoodFile.txt",
+        "-j"};
+
+    testing::internal::CaptureStdout();
+    auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal));
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_STRNE(output.c_str(), "");
+    EXPECT_EQ(nullptr, pMultiCommand);
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+}
+TEST_F(MultiCommandTests, GivenInvalidJobsCountWhenMultiCommandIsCreatedThenInvalidCommandLineIsReturned) {
+    for (auto jobsArg : {"foo", "-1", "2x", ""}) {
+        std::vector<std::string> argv = {
+            "ocloc",
+            "-multi",
+            "test_files/ImAMulitiComandMinimalGoodFile.txt",
+            "-j",
+            jobsArg};
+
+        testing::internal::CaptureStdout();
+        auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal));
+        std::string output = testing::internal::GetCapturedStdout();
+
+        EXPECT_NE(std::string::npos, output.find("Invalid jobs count")) << jobsArg;
+        EXPECT_EQ(nullptr, pMultiCommand);
+        EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+    }
+}
 TEST_F(OfflineCompilerTests, GoodArgTest) {
     std::vector<std::string> argv = {
         "ocloc",
@@ -849,6 +929,63 @@ TEST(OfflineCompilerTest, givenIntermediatedRepresentationInputWhenBuildSourceCo
     ASSERT_EQ(expectedTranslation, mockIgcOclDeviceCtx->requestedTranslationCtxs[0]);
 }
 
+TEST(OfflineCompilerTest, givenSourceInputWhenFrontendCompilationKeyIsQueriedThenKeyDependsOnFrontendInputs) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler mockOfflineCompiler;
+    auto retVal = mockOfflineCompiler.initialize(argv.size(), argv);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto key = mockOfflineCompiler.getFrontendCompilationKey();
+    EXPECT_FALSE(key.empty());
+
+    mockOfflineCompiler.getInternalOptions().append(" -some-other-internal-option");
+    EXPECT_NE(key, mockOfflineCompiler.getFrontendCompilationKey());
+
+    mockOfflineCompiler.useLlvmText = true;
+    EXPECT_TRUE(mockOfflineCompiler.getFrontendCompilationKey().empty());
+
+    mockOfflineCompiler.useLlvmText = false;
+    mockOfflineCompiler.inputFileSpirV = true;
+    EXPECT_TRUE(mockOfflineCompiler.getFrontendCompilationKey().empty());
+}
+
+TEST(OfflineCompilerTest, givenSharedIntermediateRepresentationWhenBuildSourceCodeIsCalledThenFrontendIsSkippedAndIrIsKept) {
+    MockOfflineCompiler mockOfflineCompiler;
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    auto retVal = mockOfflineCompiler.initialize(argv.size(), argv);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto mockIgcOclDeviceCtx = new NEO::MockIgcOclDeviceCtx();
+    mockOfflineCompiler.igcDeviceCtx = CIF::RAII::Pack<IGC::IgcOclDeviceCtxLatest>(mockIgcOclDeviceCtx);
+
+    const uint8_t sharedIr[] = {0x03, 0x02, 0x23, 0x07, 0x00, 0x01};
+    mockOfflineCompiler.useIntermediateRepresentation(ArrayRef<const uint8_t>(sharedIr), true);
+    EXPECT_TRUE(mockOfflineCompiler.inputFileSpirV);
+    EXPECT_TRUE(mockOfflineCompiler.isIntermediateRepresentationSpirV());
+    EXPECT_EQ(sizeof(sharedIr), mockOfflineCompiler.sourceCode.size());
+
+    retVal = mockOfflineCompiler.buildSourceCode();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(1U, mockIgcOclDeviceCtx->requestedTranslationCtxs.size());
+    NEO::MockIgcOclDeviceCtx::TranslationOpT expectedTranslation = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    EXPECT_EQ(expectedTranslation, mockIgcOclDeviceCtx->requestedTranslationCtxs[0]);
+
+    auto ir = mockOfflineCompiler.getIntermediateRepresentation();
+    ASSERT_EQ(sizeof(sharedIr), ir.size());
+    EXPECT_EQ(0, memcmp(sharedIr, ir.begin(), sizeof(sharedIr)));
+}
+
 TEST(OfflineCompilerTest, givenBinaryInputThenDontTruncateSourceAtFirstZero) {
     std::vector<std::string> argvLlvm = {"ocloc", "-llvm_input", "-file", "test_files/binary_with_zeroes",
                                          "-device", gEnvironment->devicePrefix.c_str()};
@@ -9,7 +9,10 @@
 #include "gtest/gtest.h"
 #include "segfault_helper.h"
 
+#include <atomic>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std;
 
@@ -41,3 +44,28 @@ TEST(SegFault, givenCallWithSafetyGuardWhenSegfaultHappensThenCallstackIsPrinted
     generateSegfaultWithSafetyGuard(&segfault);
 #endif
 }
+
+std::atomic<uint32_t> recoveredSegfaults{0u};
+
+void countRecoveredSegfault() {
+    recoveredSegfaults++;
+}
+
+TEST(SegFault, givenCallsWithSafetyGuardOnManyThreadsWhenEachCallSegfaultsThenEveryCallIsRecoveredOnItsOwnThread) {
+#if !defined(SKIP_SEGFAULT_TEST)
+    recoveredSegfaults = 0u;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([]() {
+            SegfaultHelper segfault;
+            segfault.segfaultHandlerCallback = countRecoveredSegfault;
+
+            generateSegfaultWithSafetyGuard(&segfault);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(4u, recoveredSegfaults);
+#endif
+}
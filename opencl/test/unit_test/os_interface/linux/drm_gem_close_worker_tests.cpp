@@ -12,6 +12,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/command_stream/device_command_stream.h"
 #include "opencl/source/mem_obj/buffer.h"
@@ -189,3 +190,78 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsWithGpuRangeWhenPushedThenGpuRangeIsReleasedAfterAllBufferObjectsAreClosed) {
+    struct DrmMemoryManagerWithGpuRangeTracking : DrmMemoryManager {
+        DrmMemoryManagerWithGpuRangeTracking(DrmMockForWorker &drm, ExecutionEnvironment &executionEnvironment)
+            : DrmMemoryManager(gemCloseWorkerMode::gemCloseWorkerInactive, false, false, executionEnvironment), drm(drm) {}
+        void releaseGpuRange(void *address, size_t size, uint32_t rootDeviceIndex) override {
+            releasedGpuRanges.push_back(address);
+            gemClosesBeforeRelease = drm.gem_close_cnt.load();
+        }
+        DrmMockForWorker &drm;
+        std::vector<void *> releasedGpuRanges;
+        int gemClosesBeforeRelease = -1;
+    };
+    this->drmMock->gem_close_expected = 2;
+
+    DrmMemoryManagerWithGpuRangeTracking memoryManager(*this->drmMock, executionEnvironment);
+    auto worker = new DrmGemCloseWorker(memoryManager);
+    BufferObject *bos[] = {new BufferObject(this->drmMock, 1, 0), nullptr, new BufferObject(this->drmMock, 2, 0)};
+
+    DeferredGpuRange gpuRange;
+    gpuRange.address = reinterpret_cast<void *>(0x10000);
+    gpuRange.size = MemoryConstants::pageSize;
+    worker->push(bos, 3, gpuRange);
+
+    delete worker;
+
+    ASSERT_EQ(1u, memoryManager.releasedGpuRanges.size());
+    EXPECT_EQ(gpuRange.address, memoryManager.releasedGpuRanges[0]);
+    EXPECT_EQ(2, memoryManager.gemClosesBeforeRelease);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDeferredBufferObjectCloseEnabledWhenAllocationIsFreedThenBufferObjectIsClosedOnWorkerThread) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDeferredBufferObjectClose.set(1);
+    this->drmMock->gem_close_expected = 1;
+
+    std::unique_ptr<DrmMemoryManager> memoryManager(new DrmMemoryManager(gemCloseWorkerMode::gemCloseWorkerActive, false, false, executionEnvironment));
+    auto bo = new BufferObject(this->drmMock, 1, 0);
+    memoryManager->freeGraphicsMemory(new DrmAllocationWrapper(bo));
+
+    //wait for worker to complete or deadCnt drops
+    while (!memoryManager->peekGemCloseWorker()->isEmpty() && (deadCnt-- > 0))
+        pthread_yield(); //yield to another threads
+
+    EXPECT_EQ(1, this->drmMock->gem_close_cnt.load());
+    EXPECT_NE(drmMock->ioctl_caller_thread_id, std::this_thread::get_id());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenUserptrCacheEntryWhenWorkerStaysIdleLongerThanIdleTimeoutThenEntryIsReleasedOnWorkerThread) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserptrBoCache.set(1);
+    DebugManager.flags.UserptrBoCacheIdleTimeoutMs.set(1);
+    this->drmMock->gem_close_expected = 1;
+
+    std::unique_ptr<DrmMemoryManager> memoryManager(new DrmMemoryManager(gemCloseWorkerMode::gemCloseWorkerActive, false, false, executionEnvironment));
+    auto userptrCache = memoryManager->peekUserptrCache();
+    ASSERT_NE(nullptr, userptrCache);
+
+    UserptrBufferObjectCache::Entry entry;
+    entry.cpuPtr = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    entry.bo = new BufferObject(this->drmMock, 1, 0);
+    entry.size = MemoryConstants::pageSize;
+    std::vector<UserptrBufferObjectCache::Entry> evictedEntries;
+    userptrCache->store(entry, std::chrono::steady_clock::now(), evictedEntries);
+    EXPECT_TRUE(evictedEntries.empty());
+
+    //wait for worker to trim the cache or deadCnt drops
+    while (this->drmMock->gem_close_cnt.load() == 0 && (deadCnt-- > 0))
+        pthread_yield(); //yield to another threads
+
+    EXPECT_EQ(0u, userptrCache->getEntriesCount());
+    memoryManager.reset();
+    EXPECT_EQ(1, this->drmMock->gem_close_cnt.load());
+    EXPECT_NE(drmMock->ioctl_caller_thread_id, std::this_thread::get_id());
+}
@@ -3408,4 +3408,69 @@ TEST(DrmMemoryMangerTest, givenMultipleRootDeviceWhenMemoryManagerGetsDrmThenDrm
         EXPECT_EQ(drmFromRootDevice, &drmMemoryManager.getDrm(i));
     }
 }
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenHugePageAllocationsEnabledWhenAllocatingAboveThresholdThenBoIsCreatedFor2MBAlignedMemoryInSystem2MBPagesPool) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHugePageAllocations.set(1);
+    DebugManager.flags.HugePageAllocationThresholdInKb.set(1024);
+    auto drmMemoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+
+    auto allocation = static_cast<DrmAllocation *>(drmMemoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::megaByte + MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryPool::System2MBPages, allocation->getMemoryPool());
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2Mb>(allocation->getUnderlyingBuffer()));
+    EXPECT_EQ(MemoryConstants::pageSize2Mb, allocation->getBO()->peekSize());
+    drmMemoryManager->freeGraphicsMemory(allocation);
+
+    allocation = static_cast<DrmAllocation *>(drmMemoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryPool::System4KBPages, allocation->getMemoryPool());
+    drmMemoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenUserptrBoCacheDisabledByDefaultWhenMemoryManagerIsCreatedThenCacheIsNotCreated) {
+    EXPECT_EQ(nullptr, memoryManager->peekUserptrCache());
+}
+
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenUserptrBoCacheEnabledWhenAllocationIsFreedAndReallocatedThenHostMemoryAndBufferObjectAreReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserptrBoCache.set(1);
+    auto drmMemoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    ASSERT_NE(nullptr, drmMemoryManager->peekUserptrCache());
+
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto allocation = static_cast<DrmAllocation *>(drmMemoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{3 * MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, allocation);
+    auto cpuPtr = allocation->getUnderlyingBuffer();
+    auto bo = allocation->getBO();
+    drmMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, drmMemoryManager->peekUserptrCache()->getEntriesCount());
+
+    allocation = static_cast<DrmAllocation *>(drmMemoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{3 * MemoryConstants::pageSize - 1}));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(cpuPtr, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(0u, drmMemoryManager->peekUserptrCache()->getEntriesCount());
+    drmMemoryManager->freeGraphicsMemory(allocation);
+
+    drmMemoryManager.reset();
+    mock->testIoctls();
+}
+
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenUserptrBoCacheEnabledWhenBufferObjectIsReferencedElsewhereThenAllocationIsNotCached) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserptrBoCache.set(1);
+    auto drmMemoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+
+    auto allocation = static_cast<DrmAllocation *>(drmMemoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    bo->reference();
+    drmMemoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, drmMemoryManager->peekUserptrCache()->getEntriesCount());
+
+    drmMemoryManager->unreference(bo, false);
+}
 } // namespace NEO
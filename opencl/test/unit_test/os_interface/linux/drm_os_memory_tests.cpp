@@ -22,6 +22,7 @@ class MockOSMemoryLinux : public OSMemoryLinux {
 
     MOCK_METHOD6(mmapWrapper, void *(void *, size_t, int, int, int, off_t));
     MOCK_METHOD2(munmapWrapper, int(void *, size_t));
+    MOCK_METHOD3(madviseWrapper, int(void *, size_t, int));
 };
 
 TEST(OSMemoryLinux, givenOSMemoryLinuxWhenReserveCpuAddressRangeIsCalledThenMinusOneIsPassedToMmapAsFdParam) {
@@ -37,4 +38,14 @@ TEST(OSMemoryLinux, givenOSMemoryLinuxWhenReserveCpuAddressRangeIsCalledThenMinu
     mockOSMemoryLinux->releaseCpuAddressRange(reservedCpuAddr, size);
 }
 
+TEST(OSMemoryLinux, givenOSMemoryLinuxWhenAdviseHugePagesIsCalledThenMadviseIsCalledWithHugePageAdvice) {
+    auto mockOSMemoryLinux = MockOSMemoryLinux::create();
+    auto address = reinterpret_cast<void *>(0x200000);
+    size_t size = 0x400000;
+
+    EXPECT_CALL(*mockOSMemoryLinux, madviseWrapper(address, size, MADV_HUGEPAGE));
+
+    mockOSMemoryLinux->adviseHugePages(address, size);
+}
+
 }; // namespace NEO
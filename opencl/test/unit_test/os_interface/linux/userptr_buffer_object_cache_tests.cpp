@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/memory_constants.h"
+#include "shared/source/os_interface/linux/userptr_buffer_object_cache.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+UserptrBufferObjectCache::Entry createEntry(uintptr_t cpuAddress, size_t size) {
+    UserptrBufferObjectCache::Entry entry;
+    entry.cpuPtr = reinterpret_cast<void *>(cpuAddress);
+    entry.bo = reinterpret_cast<BufferObject *>(cpuAddress);
+    entry.size = size;
+    return entry;
+}
+} // namespace
+
+TEST(UserptrBufferObjectCacheTest, givenSizeWhenSizeClassIsQueriedThenSizeIsRoundedToClassGranularity) {
+    EXPECT_EQ(MemoryConstants::pageSize, UserptrBufferObjectCache::getSizeClass(1u));
+    EXPECT_EQ(3 * MemoryConstants::pageSize, UserptrBufferObjectCache::getSizeClass(3 * MemoryConstants::pageSize));
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, UserptrBufferObjectCache::getSizeClass(MemoryConstants::pageSize64k + 1));
+    EXPECT_EQ(static_cast<size_t>(MemoryConstants::megaByte), UserptrBufferObjectCache::getSizeClass(static_cast<size_t>(MemoryConstants::megaByte)));
+    EXPECT_EQ(static_cast<size_t>(5 * MemoryConstants::megaByte / 4), UserptrBufferObjectCache::getSizeClass(static_cast<size_t>(MemoryConstants::megaByte + 1)));
+    EXPECT_EQ(static_cast<size_t>(10 * MemoryConstants::megaByte), UserptrBufferObjectCache::getSizeClass(static_cast<size_t>(9 * MemoryConstants::megaByte)));
+}
+
+TEST(UserptrBufferObjectCacheTest, givenStoredEntryWhenSameSizeClassIsRequestedThenEntryIsReusedOnlyOnce) {
+    UserptrBufferObjectCache cache(MemoryConstants::megaByte, std::chrono::milliseconds(1000));
+    auto now = UserptrBufferObjectCache::TimePoint{};
+    std::vector<UserptrBufferObjectCache::Entry> evicted;
+
+    cache.store(createEntry(0x10000, MemoryConstants::pageSize), now, evicted);
+    EXPECT_TRUE(evicted.empty());
+    EXPECT_EQ(MemoryConstants::pageSize, cache.getCachedSize());
+
+    UserptrBufferObjectCache::Entry entry;
+    EXPECT_FALSE(cache.tryReuse(0u, 2 * MemoryConstants::pageSize, MemoryConstants::pageSize, now, entry, evicted));
+    EXPECT_FALSE(cache.tryReuse(1u, MemoryConstants::pageSize, MemoryConstants::pageSize, now, entry, evicted));
+    EXPECT_FALSE(cache.tryReuse(0u, MemoryConstants::pageSize, MemoryConstants::pageSize64k * 2, now, entry, evicted));
+    EXPECT_TRUE(cache.tryReuse(0u, MemoryConstants::pageSize, MemoryConstants::pageSize, now, entry, evicted));
+    EXPECT_EQ(reinterpret_cast<void *>(0x10000), entry.cpuPtr);
+    EXPECT_EQ(0u, cache.getCachedSize());
+    EXPECT_FALSE(cache.tryReuse(0u, MemoryConstants::pageSize, MemoryConstants::pageSize, now, entry, evicted));
+    EXPECT_TRUE(evicted.empty());
+}
+
+TEST(UserptrBufferObjectCacheTest, givenEntriesExceedingMaxSizeWhenStoringThenOldestEntriesAreEvicted) {
+    UserptrBufferObjectCache cache(2 * MemoryConstants::pageSize, std::chrono::milliseconds(1000));
+    auto now = UserptrBufferObjectCache::TimePoint{};
+    std::vector<UserptrBufferObjectCache::Entry> evicted;
+
+    cache.store(createEntry(0x10000, MemoryConstants::pageSize), now, evicted);
+    cache.store(createEntry(0x20000, MemoryConstants::pageSize), now + std::chrono::milliseconds(1), evicted);
+    cache.store(createEntry(0x30000, 2 * MemoryConstants::pageSize), now + std::chrono::milliseconds(2), evicted);
+
+    ASSERT_EQ(2u, evicted.size());
+    EXPECT_EQ(reinterpret_cast<void *>(0x10000), evicted[0].cpuPtr);
+    EXPECT_EQ(reinterpret_cast<void *>(0x20000), evicted[1].cpuPtr);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, cache.getCachedSize());
+    EXPECT_EQ(1u, cache.getEntriesCount());
+}
+
+TEST(UserptrBufferObjectCacheTest, givenIdleEntriesWhenTrimIsCalledAfterTimeoutThenOnlyExpiredEntriesAreEvicted) {
+    UserptrBufferObjectCache cache(MemoryConstants::megaByte, std::chrono::milliseconds(10));
+    auto now = UserptrBufferObjectCache::TimePoint{};
+    std::vector<UserptrBufferObjectCache::Entry> evicted;
+
+    cache.store(createEntry(0x10000, MemoryConstants::pageSize), now, evicted);
+    cache.store(createEntry(0x20000, MemoryConstants::pageSize), now + std::chrono::milliseconds(8), evicted);
+
+    cache.trim(now + std::chrono::milliseconds(10), evicted);
+    EXPECT_TRUE(evicted.empty());
+
+    cache.trim(now + std::chrono::milliseconds(15), evicted);
+    ASSERT_EQ(1u, evicted.size());
+    EXPECT_EQ(reinterpret_cast<void *>(0x10000), evicted[0].cpuPtr);
+
+    evicted.clear();
+    cache.trimAll(evicted);
+    ASSERT_EQ(1u, evicted.size());
+    EXPECT_EQ(0u, cache.getCachedSize());
+    EXPECT_EQ(0u, cache.getEntriesCount());
+}
@@ -88,6 +88,47 @@ TEST_F(ContextTest, clReleaseContext) {
     updateTestRatio(hash, ratio);
 }
 
+TEST_F(ContextTest, clReleaseContextWithBuffers) {
+    constexpr uint32_t numBuffers = 1024U;
+
+    double previousRatio = -1.0;
+    uint64_t hash = getHash(__FUNCTION__, strlen(__FUNCTION__));
+
+    bool success = getTestRatio(hash, previousRatio);
+    long long times[3] = {0, 0, 0};
+
+    cl_device_id clDevice = pDevice;
+    std::vector<cl_mem> buffers(numBuffers);
+
+    for (int i = 0; i < 3; i++) {
+        auto context = Context::create(nullptr, DeviceVector(&clDevice, 1), nullptr, nullptr, retVal);
+        for (auto &buffer : buffers) {
+            buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal);
+        }
+
+        Timer t;
+        t.start();
+        for (auto &buffer : buffers) {
+            clReleaseMemObject(buffer);
+        }
+        auto retVal = clReleaseContext(context);
+        t.end();
+
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        times[i] = t.get();
+    }
+
+    long long time = majorityVote(times[0], times[1], times[2]);
+
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+
+    updateTestRatio(hash, ratio);
+}
+
 TEST_F(ContextTest, clRetainContext) {
     double previousRatio = -1.0;
     uint64_t hash = getHash(__FUNCTION__, strlen(__FUNCTION__));
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/gmm_helper/client_context/gmm_client_context.h"
+
+#include "opencl/source/device/cl_device.h"
+
+#include "cl_api_tests.h"
+
+#include <vector>
+
+using namespace NEO;
+
+typedef api_tests ImageTest;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double ratioThreshold = 0.005;
+
+constexpr size_t numImagesCreated = 1024U;
+
+//------------------------------------------------------------------------------
+// clCreateImage with identical format and descriptor
+//------------------------------------------------------------------------------
+
+static void measureIdenticalImagesCreation(const char *testName, Context *context, bool useImageResourceCache) {
+    auto enableImageResourceCache = DebugManager.flags.EnableImageResourceCache.get();
+    DebugManager.flags.EnableImageResourceCache.set(useImageResourceCache ? 1 : 0);
+
+    double previousRatio = -1.0;
+    uint64_t hash = getHash(testName, strlen(testName));
+
+    bool success = getTestRatio(hash, previousRatio);
+    long long times[3] = {0, 0, 0};
+
+    cl_image_format imageFormat = {CL_RGBA, CL_UNORM_INT8};
+    cl_image_desc imageDesc = {};
+    imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imageDesc.image_width = 64;
+    imageDesc.image_height = 64;
+    std::vector<cl_mem> images(numImagesCreated, nullptr);
+
+    for (int i = 0; i < 3; i++) {
+        cl_int retVal = CL_SUCCESS;
+        Timer t;
+        t.start();
+        for (auto &image : images) {
+            image = clCreateImage(context, CL_MEM_READ_WRITE, &imageFormat, &imageDesc, nullptr, &retVal);
+        }
+        t.end();
+
+        times[i] = t.get();
+        for (auto &image : images) {
+            EXPECT_NE(nullptr, image);
+            clReleaseMemObject(image);
+        }
+    }
+
+    long long time = majorityVote(times[0], times[1], times[2]);
+
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+
+    updateTestRatio(hash, ratio);
+
+    context->getDevice(0)->getRootDeviceEnvironment().getGmmClientContext()->getImageResourceCache().clear();
+    DebugManager.flags.EnableImageResourceCache.set(enableImageResourceCache);
+}
+
+TEST_F(ImageTest, clCreateImageIdentical) {
+    measureIdenticalImagesCreation(__FUNCTION__, pContext, false);
+}
+
+TEST_F(ImageTest, clCreateImageIdenticalWithImageResourceCache) {
+    measureIdenticalImagesCreation(__FUNCTION__, pContext, true);
+}
+} // namespace ULT
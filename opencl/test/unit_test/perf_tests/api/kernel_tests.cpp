@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include "opencl/source/kernel/kernel.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+typedef api_tests KernelTest;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double ratioThreshold = 0.005;
+
+constexpr uint32_t numSetArgCalls = 100000U;
+constexpr uint32_t structMembersCount = 8U;
+
+enum SetArgTestArg : uint32_t {
+    scalarArg = 0,
+    vectorArg,
+    structArg
+};
+
+//------------------------------------------------------------------------------
+// clSetKernelArg for scalar, vector and struct immediate arguments
+//------------------------------------------------------------------------------
+
+static void measureSetKernelArg(const char *testName, MockProgram *program, SetArgTestArg argIndex, bool useArgPatchPlan) {
+    auto enableKernelArgPatchPlan = DebugManager.flags.EnableKernelArgPatchPlan.get();
+    DebugManager.flags.EnableKernelArgPatchPlan.set(useArgPatchPlan ? 1 : 0);
+
+    SPatchDataParameterStream dataParameterStream = {};
+    dataParameterStream.DataParameterStreamSize = 64;
+
+    KernelInfo kernelInfo;
+    kernelInfo.patchInfo.dataParameterStream = &dataParameterStream;
+    kernelInfo.storeKernelArgPatchInfo(scalarArg, sizeof(uint32_t), 0x0, 0, 0);
+    for (uint32_t i = 0; i < 4; i++) {
+        kernelInfo.storeKernelArgPatchInfo(vectorArg, sizeof(float), 0x10 + i * sizeof(float), i * sizeof(float), 0);
+    }
+    // every struct member is patched separately, the plan merges them into one copy
+    for (uint32_t i = 0; i < structMembersCount; i++) {
+        kernelInfo.storeKernelArgPatchInfo(structArg, sizeof(uint32_t), 0x20 + i * sizeof(uint32_t), i * sizeof(uint32_t), 0);
+    }
+
+    cl_int retVal = CL_SUCCESS;
+    auto kernel = Kernel::create<MockKernel>(program, kernelInfo, &retVal);
+    ASSERT_NE(nullptr, kernel);
+
+    uint32_t scalarValue = 1U;
+    float vectorValue[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    uint32_t structValue[structMembersCount] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+    size_t argSize = sizeof(structValue);
+    const void *argValue = structValue;
+    if (argIndex == scalarArg) {
+        argSize = sizeof(scalarValue);
+        argValue = &scalarValue;
+    } else if (argIndex == vectorArg) {
+        argSize = sizeof(vectorValue);
+        argValue = vectorValue;
+    }
+
+    double previousRatio = -1.0;
+    uint64_t hash = getHash(testName, strlen(testName));
+
+    bool success = getTestRatio(hash, previousRatio);
+    long long times[3] = {0, 0, 0};
+
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (uint32_t call = 0; call < numSetArgCalls; call++) {
+            retVal = clSetKernelArg(kernel, argIndex, argSize, argValue);
+        }
+        t.end();
+
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        times[i] = t.get();
+    }
+
+    long long time = majorityVote(times[0], times[1], times[2]);
+
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+
+    updateTestRatio(hash, ratio);
+
+    kernel->release();
+    DebugManager.flags.EnableKernelArgPatchPlan.set(enableKernelArgPatchPlan);
+}
+
+TEST_F(KernelTest, clSetKernelArgScalar) {
+    measureSetKernelArg(__FUNCTION__, pProgram, scalarArg, false);
+}
+
+TEST_F(KernelTest, clSetKernelArgScalarWithArgPatchPlan) {
+    measureSetKernelArg(__FUNCTION__, pProgram, scalarArg, true);
+}
+
+TEST_F(KernelTest, clSetKernelArgVector) {
+    measureSetKernelArg(__FUNCTION__, pProgram, vectorArg, false);
+}
+
+TEST_F(KernelTest, clSetKernelArgVectorWithArgPatchPlan) {
+    measureSetKernelArg(__FUNCTION__, pProgram, vectorArg, true);
+}
+
+TEST_F(KernelTest, clSetKernelArgStruct) {
+    measureSetKernelArg(__FUNCTION__, pProgram, structArg, false);
+}
+
+TEST_F(KernelTest, clSetKernelArgStructWithArgPatchPlan) {
+    measureSetKernelArg(__FUNCTION__, pProgram, structArg, true);
+}
+} // namespace ULT
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/device_binary_format/elf/elf_encoder.h"
+#include "shared/source/device_binary_format/elf/ocl_elf.h"
+#include "shared/source/device_binary_format/patchtokens_decoder.h"
+#include "shared/source/device_binary_format/patchtokens_validator.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/program/program_info.h"
+#include "shared/source/program/program_info_from_patchtokens.h"
+#include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+
+#include "opencl/source/program/kernel_info.h"
+
+#include "../perf_test_utils.h"
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double ratioThreshold = 0.005;
+
+constexpr uint32_t numKernelsInSyntheticProgram = 4096U;
+constexpr uint32_t numEntriesInSyntheticArchive = 64U;
+
+struct DeviceBinaryFormatPerfTest : public ::testing::Test {
+    void SetUp() override {
+        setReferenceTime();
+
+        PatchTokensTestData::ValidProgramWithKernelAndArg program;
+        std::vector<uint8_t> kernelBlob(program.kernels[0].blobs.kernelInfo.begin(), program.kernels[0].blobs.kernelInfo.end());
+        program.headerMutable->NumberOfKernels = numKernelsInSyntheticProgram;
+        patchtokensBinary = program.storage;
+        patchtokensBinary.reserve(patchtokensBinary.size() + (numKernelsInSyntheticProgram - 1) * kernelBlob.size());
+        for (uint32_t i = 1; i < numKernelsInSyntheticProgram; ++i) {
+            patchtokensBinary.insert(patchtokensBinary.end(), kernelBlob.begin(), kernelBlob.end());
+        }
+
+        Elf::ElfEncoder<Elf::EI_CLASS_64> elfEncoder;
+        elfEncoder.getElfFileHeader().type = Elf::ET_OPENCL_EXECUTABLE;
+        elfEncoder.appendSection(Elf::SHT_OPENCL_DEV_BINARY, Elf::SectionNamesOpenCl::deviceBinary, patchtokensBinary);
+        elfBinary = elfEncoder.encode();
+
+        Ar::ArEncoder arEncoder;
+        for (uint32_t i = 0; i < numEntriesInSyntheticArchive; ++i) {
+            arEncoder.appendFileEntry("entry_" + std::to_string(i), elfBinary);
+        }
+        arBinary = arEncoder.encode();
+
+        prevMinKernelsCountForParallelDecode = PatchTokenBinary::minKernelsCountForParallelDecode;
+    }
+
+    void TearDown() override {
+        PatchTokenBinary::minKernelsCountForParallelDecode = prevMinKernelsCountForParallelDecode;
+    }
+
+    void measure(const char *testName, const std::function<void()> &testedCode) {
+        double previousRatio = -1.0;
+        uint64_t hash = Hash::hash(testName, strlen(testName));
+
+        bool success = getTestRatio(hash, previousRatio);
+        long long times[3] = {0, 0, 0};
+
+        for (int i = 0; i < 3; i++) {
+            Timer t;
+            t.start();
+            testedCode();
+            t.end();
+
+            times[i] = t.get();
+        }
+
+        long long time = majorityVote(times[0], times[1], times[2]);
+
+        double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+        if (success && previousRatio > ratioThreshold) {
+            EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+        }
+
+        updateTestRatio(hash, ratio);
+    }
+
+    void setParallelDecodeEnabled(bool enabled) {
+        PatchTokenBinary::minKernelsCountForParallelDecode = enabled ? 1U : std::numeric_limits<size_t>::max();
+    }
+
+    void decodeProgram(PatchTokenBinary::ProgramFromPatchtokens &decodedProgram) {
+        ASSERT_TRUE(PatchTokenBinary::decodeProgramFromPatchtokensBlob(patchtokensBinary, decodedProgram));
+        ASSERT_EQ(numKernelsInSyntheticProgram, decodedProgram.kernels.size());
+    }
+
+    void testDecode(const char *testName, bool parallel) {
+        setParallelDecodeEnabled(parallel);
+        measure(testName, [&]() {
+            PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+            decodeProgram(decodedProgram);
+        });
+    }
+
+    void testValidate(const char *testName, bool parallel) {
+        setParallelDecodeEnabled(parallel);
+        PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+        decodeProgram(decodedProgram);
+        measure(testName, [&]() {
+            std::string errors, warnings;
+            EXPECT_EQ(DecodeError::Success, PatchTokenBinary::validate(decodedProgram, errors, warnings)) << errors;
+        });
+    }
+
+    void testPopulateProgramInfo(const char *testName, bool parallel) {
+        setParallelDecodeEnabled(parallel);
+        PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+        decodeProgram(decodedProgram);
+        measure(testName, [&]() {
+            ProgramInfo programInfo;
+            populateProgramInfo(programInfo, decodedProgram);
+            EXPECT_EQ(numKernelsInSyntheticProgram, programInfo.kernelInfos.size());
+        });
+    }
+
+    void testDecodeSingleDeviceBinary(const char *testName, bool parallel) {
+        setParallelDecodeEnabled(parallel);
+        SingleDeviceBinary deviceBinary;
+        deviceBinary.format = DeviceBinaryFormat::Patchtokens;
+        deviceBinary.deviceBinary = patchtokensBinary;
+        deviceBinary.targetDevice.coreFamily = renderCoreFamily;
+        deviceBinary.targetDevice.maxPointerSizeInBytes = 8U;
+        measure(testName, [&]() {
+            ProgramInfo programInfo;
+            std::string errors, warnings;
+            auto decodeResult = decodeSingleDeviceBinary(programInfo, deviceBinary, errors, warnings);
+            EXPECT_EQ(DecodeError::Success, decodeResult.first) << errors;
+        });
+    }
+
+    std::vector<uint8_t> patchtokensBinary;
+    std::vector<uint8_t> elfBinary;
+    std::vector<uint8_t> arBinary;
+    size_t prevMinKernelsCountForParallelDecode = 0U;
+};
+
+TEST_F(DeviceBinaryFormatPerfTest, decodeProgramFromPatchtokensBlob) {
+    testDecode(__FUNCTION__, false);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, decodeProgramFromPatchtokensBlobParallel) {
+    testDecode(__FUNCTION__, true);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, validatePatchtokens) {
+    testValidate(__FUNCTION__, false);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, validatePatchtokensParallel) {
+    testValidate(__FUNCTION__, true);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, populateProgramInfo) {
+    testPopulateProgramInfo(__FUNCTION__, false);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, populateProgramInfoParallel) {
+    testPopulateProgramInfo(__FUNCTION__, true);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, decodeSingleDeviceBinaryPatchtokens) {
+    testDecodeSingleDeviceBinary(__FUNCTION__, false);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, decodeSingleDeviceBinaryPatchtokensParallel) {
+    testDecodeSingleDeviceBinary(__FUNCTION__, true);
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, decodeElf) {
+    measure(__FUNCTION__, [&]() {
+        std::string errors, warnings;
+        auto elf = Elf::decodeElf<Elf::EI_CLASS_64>(elfBinary, errors, warnings);
+        EXPECT_NE(nullptr, elf.elfFileHeader) << errors;
+    });
+}
+
+TEST_F(DeviceBinaryFormatPerfTest, decodeAr) {
+    measure(__FUNCTION__, [&]() {
+        std::string errors, warnings;
+        auto ar = Ar::decodeAr(arBinary, errors, warnings);
+        EXPECT_EQ(numEntriesInSyntheticArchive, ar.files.size()) << errors;
+    });
+}
+
+} // namespace ULT
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/unit_test/page_fault_manager/mock_cpu_page_fault_manager.h"
+
+#include "../perf_test_utils.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double ratioThreshold = 0.005;
+
+constexpr uint32_t numEnqueues = 10000U;
+
+//------------------------------------------------------------------------------
+// Shared allocations migration before kernels using indirect access, only one
+// allocation is touched by cpu between two enqueues
+//------------------------------------------------------------------------------
+
+static void measureMoveAllocationsToGpuDomain(const char *testName, uint32_t allocationsCount) {
+    setReferenceTime();
+    auto pageFaultManager = std::make_unique<MockPageFaultManager>();
+    auto unifiedMemoryManager = reinterpret_cast<SVMAllocsManager *>(0x1111);
+    auto basePtr = reinterpret_cast<void *>(0x10000);
+
+    for (uint32_t i = 0; i < allocationsCount; i++) {
+        pageFaultManager->insertAllocation(ptrOffset(basePtr, i * MemoryConstants::pageSize), MemoryConstants::pageSize, unifiedMemoryManager, nullptr);
+    }
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager);
+
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(testName, strlen(testName));
+
+    bool success = getTestRatio(hash, previousRatio);
+    long long times[3] = {0, 0, 0};
+
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (uint32_t enqueue = 0; enqueue < numEnqueues; enqueue++) {
+            pageFaultManager->verifyPageFault(ptrOffset(basePtr, (enqueue % allocationsCount) * MemoryConstants::pageSize));
+            pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager);
+        }
+        t.end();
+
+        times[i] = t.get();
+    }
+
+    long long time = majorityVote(times[0], times[1], times[2]);
+
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+
+    updateTestRatio(hash, ratio);
+}
+
+TEST(PageFaultManagerPerfTest, moveAllocationsToGpuDomainWith16SharedAllocations) {
+    measureMoveAllocationsToGpuDomain(__FUNCTION__, 16);
+}
+
+TEST(PageFaultManagerPerfTest, moveAllocationsToGpuDomainWith1024SharedAllocations) {
+    measureMoveAllocationsToGpuDomain(__FUNCTION__, 1024);
+}
+
+TEST(PageFaultManagerPerfTest, moveAllocationsToGpuDomainWith16384SharedAllocations) {
+    measureMoveAllocationsToGpuDomain(__FUNCTION__, 16384);
+}
+} // namespace ULT
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/parallel_memcpy.h"
+
+#include "../perf_test_utils.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double ratioThreshold = 0.005;
+
+constexpr size_t transferSize = 64 * MemoryConstants::megaByte;
+
+struct ParallelMemcpyPerfTest : public ::testing::Test {
+    void SetUp() override {
+        setReferenceTime();
+        src.resize(transferSize);
+        dst.resize(transferSize);
+        memset(src.data(), 0x5A, transferSize);
+        memset(dst.data(), 0, transferSize);
+
+        enableParallelMemcpy = DebugManager.flags.EnableParallelMemcpy.get();
+        useNonTemporalStores = DebugManager.flags.ParallelMemcpyUseNonTemporalStores.get();
+    }
+
+    void TearDown() override {
+        DebugManager.flags.EnableParallelMemcpy.set(enableParallelMemcpy);
+        DebugManager.flags.ParallelMemcpyUseNonTemporalStores.set(useNonTemporalStores);
+    }
+
+    void measureCopy(const char *testName, bool parallel, bool nonTemporal) {
+        DebugManager.flags.EnableParallelMemcpy.set(parallel ? 1 : 0);
+        DebugManager.flags.ParallelMemcpyUseNonTemporalStores.set(nonTemporal ? 1 : 0);
+
+        double previousRatio = -1.0;
+        uint64_t hash = Hash::hash(testName, strlen(testName));
+
+        bool success = getTestRatio(hash, previousRatio);
+        long long times[3] = {0, 0, 0};
+
+        for (int i = 0; i < 3; i++) {
+            Timer t;
+            t.start();
+            EXPECT_EQ(0, parallelMemcpy(dst.data(), transferSize, src.data(), transferSize));
+            t.end();
+
+            times[i] = t.get();
+        }
+        EXPECT_EQ(0, memcmp(dst.data(), src.data(), transferSize));
+
+        long long time = majorityVote(times[0], times[1], times[2]);
+
+        double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+        if (success && previousRatio > ratioThreshold) {
+            EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+        }
+
+        updateTestRatio(hash, ratio);
+    }
+
+    std::vector<uint8_t> src;
+    std::vector<uint8_t> dst;
+    int32_t enableParallelMemcpy = -1;
+    int32_t useNonTemporalStores = -1;
+};
+
+TEST_F(ParallelMemcpyPerfTest, memcpy64MB) {
+    measureCopy(__FUNCTION__, false, false);
+}
+
+TEST_F(ParallelMemcpyPerfTest, parallelMemcpy64MB) {
+    measureCopy(__FUNCTION__, true, false);
+}
+
+TEST_F(ParallelMemcpyPerfTest, parallelMemcpy64MBWithNonTemporalStores) {
+    measureCopy(__FUNCTION__, true, true);
+}
+} // namespace ULT
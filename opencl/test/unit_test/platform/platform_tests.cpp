@@ -406,6 +406,45 @@ TEST(PlatformInitTest, givenSingleDeviceWithNonZeroRootDeviceIndexInPassedDevice
     EXPECT_EQ(2u, platform()->getClDevice(0)->getRootDeviceIndex());
 }
 
+TEST(PlatformInitTest, givenMultipleRootDevicesWhenPlatformIsInitializedInParallelThenClDevicesAreCreatedInRootDevicesOrder) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableParallelPlatformInitialization.set(1);
+    const uint32_t numRootDevices = 3u;
+    std::vector<std::unique_ptr<Device>> devices;
+    auto executionEnvironment = new MockExecutionEnvironment(*platformDevices, false, numRootDevices);
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        devices.push_back(std::make_unique<MockDevice>(executionEnvironment, rootDeviceIndex));
+    }
+    auto status = platform()->initialize(std::move(devices));
+    EXPECT_TRUE(status);
+    ASSERT_EQ(numRootDevices, platform()->getNumDevices());
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        EXPECT_EQ(rootDeviceIndex, platform()->getClDevice(rootDeviceIndex)->getRootDeviceIndex());
+    }
+}
+
+TEST(PlatformInitTest, givenMultipleRootDevicesWhenPlatformIsInitializedInParallelThenEachClDeviceHasConsistentCaps) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableParallelPlatformInitialization.set(1);
+    const uint32_t numRootDevices = 4u;
+    std::vector<std::unique_ptr<Device>> devices;
+    auto executionEnvironment = new MockExecutionEnvironment(*platformDevices, false, numRootDevices);
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        devices.push_back(std::make_unique<MockDevice>(executionEnvironment, rootDeviceIndex));
+    }
+    EXPECT_TRUE(platform()->initialize(std::move(devices)));
+    ASSERT_EQ(numRootDevices, platform()->getNumDevices());
+
+    // caps are built from process wide state, concurrent ClDevice creation is reported by thread sanitizer
+    auto &expectedDeviceInfo = platform()->getClDevice(0)->getDeviceInfo();
+    for (uint32_t rootDeviceIndex = 1; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        auto &deviceInfo = platform()->getClDevice(rootDeviceIndex)->getDeviceInfo();
+        EXPECT_STREQ(expectedDeviceInfo.driverVersion, deviceInfo.driverVersion);
+        EXPECT_STREQ(expectedDeviceInfo.name, deviceInfo.name);
+        EXPECT_STREQ(expectedDeviceInfo.deviceExtensions, deviceInfo.deviceExtensions);
+    }
+}
+
 TEST(PlatformInitLoopTests, givenPlatformWithDebugSettingWhenInitIsCalledThenItEntersEndlessLoop) {
     DebugManagerStateRestore stateRestore;
     DebugManager.flags.LoopAtPlatformInitialize.set(true);
@@ -143,6 +143,55 @@ TEST(KernelInfoTest, givenKernelInfoWhenCreateKernelAllocationAndCannotAllocateM
     EXPECT_FALSE(retVal);
 }
 
+TEST(KernelInfoTest, givenDeferredKernelAllocationWhenMaterializeIsCalledThenAllocationIsCreatedOnlyOnce) {
+    KernelInfo kernelInfo;
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    OsAgnosticMemoryManager memoryManager(executionEnvironment);
+    SKernelBinaryHeaderCommon kernelHeader;
+    const size_t heapSize = 0x40;
+    char heap[heapSize];
+    kernelHeader.KernelHeapSize = heapSize;
+    kernelInfo.heapInfo.pKernelHeader = &kernelHeader;
+    kernelInfo.heapInfo.pKernelHeap = &heap;
+    for (size_t i = 0; i < heapSize; i++) {
+        heap[i] = static_cast<char>(i);
+    }
+
+    kernelInfo.deferKernelAllocation(0, &memoryManager);
+    EXPECT_TRUE(kernelInfo.isKernelAllocationDeferred());
+    EXPECT_EQ(nullptr, kernelInfo.getGraphicsAllocation());
+
+    EXPECT_TRUE(kernelInfo.materializeKernelAllocation());
+    EXPECT_FALSE(kernelInfo.isKernelAllocationDeferred());
+    auto allocation = kernelInfo.getGraphicsAllocation();
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0, memcmp(allocation->getUnderlyingBuffer(), heap, heapSize));
+
+    EXPECT_TRUE(kernelInfo.materializeKernelAllocation());
+    EXPECT_EQ(allocation, kernelInfo.getGraphicsAllocation());
+    memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+}
+
+TEST(KernelInfoTest, givenDeferredKernelAllocationWhenMemoryCannotBeAllocatedThenMaterializeFailsAndAllocationStaysDeferred) {
+    KernelInfo kernelInfo;
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    MyMemoryManager memoryManager(executionEnvironment);
+    SKernelBinaryHeaderCommon kernelHeader;
+    kernelInfo.heapInfo.pKernelHeader = &kernelHeader;
+
+    kernelInfo.deferKernelAllocation(0, &memoryManager);
+    EXPECT_FALSE(kernelInfo.materializeKernelAllocation());
+    EXPECT_TRUE(kernelInfo.isKernelAllocationDeferred());
+    EXPECT_EQ(nullptr, kernelInfo.getGraphicsAllocation());
+}
+
+TEST(KernelInfoTest, givenKernelAllocationNotDeferredWhenMaterializeIsCalledThenNothingIsAllocated) {
+    KernelInfo kernelInfo;
+    EXPECT_FALSE(kernelInfo.isKernelAllocationDeferred());
+    EXPECT_TRUE(kernelInfo.materializeKernelAllocation());
+    EXPECT_EQ(nullptr, kernelInfo.getGraphicsAllocation());
+}
+
 TEST(KernelInfo, decodeGlobalMemObjectKernelArgument) {
     uint32_t argumentNumber = 1;
     auto pKernelInfo = std::make_unique<KernelInfo>();
@@ -259,3 +308,49 @@ TEST(KernelInfo, whenGetKernelNamesStringIsCalledThenNamesAreProperlyConcatenate
     kernelInfoArray.push_back(&kernel2);
     EXPECT_STREQ("kern1;kern2", concatenateKernelNames(kernelInfoArray).c_str());
 }
+
+TEST(KernelInfo, givenContiguousArgPatchInfosWhenArgPatchPlanIsObtainedThenOperationsAreMerged) {
+    KernelInfo kernelInfo;
+    kernelInfo.storeKernelArgPatchInfo(0, 4, 0x10, 0, 0);
+    kernelInfo.storeKernelArgPatchInfo(0, 4, 0x14, 4, 0);
+    kernelInfo.storeKernelArgPatchInfo(0, 4, 0x20, 8, 0);
+    kernelInfo.storeKernelArgPatchInfo(1, 8, 0x30, 0, 0);
+
+    auto &argPatchPlan = kernelInfo.obtainArgPatchPlan();
+    EXPECT_TRUE(argPatchPlan.isBuilt());
+    ASSERT_EQ(2u, argPatchPlan.getArgsCount());
+
+    auto operations = argPatchPlan.getOperations(0);
+    ASSERT_EQ(2u, operations.size());
+    EXPECT_EQ(0x10u, operations[0].crossThreadOffset);
+    EXPECT_EQ(8u, operations[0].size);
+    EXPECT_EQ(0x20u, operations[1].crossThreadOffset);
+    EXPECT_EQ(8u, operations[1].sourceOffset);
+    EXPECT_EQ(12u, argPatchPlan.getRequiredSourceSize(0));
+    EXPECT_EQ(0x24u, argPatchPlan.getRequiredCrossThreadDataSize(0));
+    EXPECT_EQ(0x38u, argPatchPlan.getRequiredCrossThreadDataSize(1));
+
+    EXPECT_EQ(1u, argPatchPlan.getOperations(1).size());
+    EXPECT_EQ(&argPatchPlan, &kernelInfo.obtainArgPatchPlan());
+}
+
+TEST(KernelInfo, givenArgValueSmallerThanRequiredWhenPatchingImmediateWithArgPatchPlanThenOnlyAvailableBytesAreCopied) {
+    KernelInfo kernelInfo;
+    kernelInfo.storeKernelArgPatchInfo(0, 4, 0x0, 0, 0);
+    kernelInfo.storeKernelArgPatchInfo(0, 4, 0x8, 4, 0);
+    kernelInfo.storeKernelArgPatchInfo(0, 4, 0x10, 8, 0);
+
+    uint8_t crossThreadData[0x20];
+    memset(crossThreadData, 0xfe, sizeof(crossThreadData));
+    uint8_t argValue[12];
+    for (uint8_t i = 0; i < sizeof(argValue); i++) {
+        argValue[i] = i;
+    }
+
+    kernelInfo.obtainArgPatchPlan().patchImmediate(0, crossThreadData, argValue, 6);
+
+    EXPECT_EQ(0, memcmp(crossThreadData, argValue, 4));
+    EXPECT_EQ(0, memcmp(crossThreadData + 0x8, argValue + 4, 2));
+    EXPECT_EQ(0xfe, crossThreadData[0xa]);
+    EXPECT_EQ(0xfe, crossThreadData[0x10]);
+}
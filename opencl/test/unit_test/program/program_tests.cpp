@@ -635,6 +635,42 @@ TEST_P(ProgramFromBinaryTest, givenProgramWhenCleanKernelInfoIsCalledThenKernelA
     EXPECT_EQ(0u, pProgram->getNumKernels());
 }
 
+TEST_P(ProgramFromBinaryTest, givenLazyKernelIsaAllocationEnabledWhenProgramIsBuiltThenIsaIsAllocatedOnFirstKernelCreation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelIsaAllocation.set(1);
+
+    cl_device_id device = pClDevice;
+    auto retVal = pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto pKernelInfo = pProgram->getKernelInfo(size_t(0));
+    EXPECT_EQ(nullptr, pKernelInfo->getGraphicsAllocation());
+    EXPECT_EQ(1u, pProgram->getNumKernelsWithDeferredIsa());
+
+    std::unique_ptr<Kernel> pKernel(Kernel::create(pProgram, *pKernelInfo, &retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto kernelAllocation = pKernelInfo->getGraphicsAllocation();
+    ASSERT_NE(nullptr, kernelAllocation);
+    EXPECT_EQ(0, memcmp(kernelAllocation->getUnderlyingBuffer(), pKernelInfo->heapInfo.pKernelHeap, pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize));
+    EXPECT_EQ(0u, pProgram->getNumKernelsWithDeferredIsa());
+
+    std::unique_ptr<Kernel> pSecondKernel(Kernel::create(pProgram, *pKernelInfo, &retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(kernelAllocation, pKernelInfo->getGraphicsAllocation());
+}
+
+TEST_P(ProgramFromBinaryTest, givenLazyKernelIsaAllocationDisabledWhenProgramIsBuiltThenIsaIsAllocatedDuringBuild) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyKernelIsaAllocation.set(0);
+
+    cl_device_id device = pClDevice;
+    auto retVal = pProgram->build(1, &device, nullptr, nullptr, nullptr, true);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_NE(nullptr, pProgram->getKernelInfo(size_t(0))->getGraphicsAllocation());
+    EXPECT_EQ(0u, pProgram->getNumKernelsWithDeferredIsa());
+}
+
 HWTEST_P(ProgramFromBinaryTest, givenProgramWhenCleanCurrentKernelInfoIsCalledButGpuIsNotYetDoneThenKernelAllocationIsPutOnDefferedFreeListAndCsrRegistersCacheFlush) {
     cl_device_id device = pClDevice;
     auto &csr = pDevice->getGpgpuCommandStreamReceiver();
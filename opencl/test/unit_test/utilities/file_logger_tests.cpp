@@ -23,6 +23,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 
 using namespace std;
 using namespace NEO;
@@ -71,6 +72,81 @@ TEST(FileLogger, WithDebugFunctionalityCreatesAndDumpsToLogFile) {
     }
 }
 
+TEST(FileLogger, givenAsyncFileLoggingEnabledWhenApiCallsAreLoggedThenLogIsWrittenInOrderAfterFlush) {
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.EnableAsyncFileLogging.set(1);
+    FullyEnabledFileLogger fileLogger(std::string("test.log"), flags);
+
+    fileLogger.logApiCall("searchString", true, 0);
+    fileLogger.logInputs("searchString2", "any");
+    fileLogger.log(true, "searchString3");
+    fileLogger.flush();
+
+    ASSERT_TRUE(fileLogger.wasFileCreated(fileLogger.getLogFileName()));
+    auto str = fileLogger.getFileString(fileLogger.getLogFileName());
+    auto position = str.find("searchString");
+    auto position2 = str.find("searchString2");
+    auto position3 = str.find("searchString3");
+    EXPECT_NE(std::string::npos, position3);
+    EXPECT_LT(position, position2);
+    EXPECT_LT(position2, position3);
+    EXPECT_EQ(0u, fileLogger.getDroppedWritesCount());
+}
+
+TEST(FileLogger, givenAsyncFileLoggingMemoryLimitExceededWhenLoggingThenWriteIsDroppedAndCounted) {
+    DebugVariables flags;
+    flags.EnableAsyncFileLogging.set(1);
+    flags.AsyncFileLoggingMemoryLimitInKb.set(1);
+    FullyEnabledFileLogger fileLogger(std::string(""), flags);
+
+    std::string bigString(2 * MemoryConstants::kiloByte, 'x');
+    fileLogger.log(true, bigString);
+    fileLogger.log(true, "searchString");
+    fileLogger.flush();
+
+    EXPECT_EQ(1u, fileLogger.getDroppedWritesCount());
+    auto str = fileLogger.getFileString(fileLogger.getLogFileName());
+    EXPECT_NE(std::string::npos, str.find("searchString"));
+    EXPECT_EQ(std::string::npos, str.find("xxxx"));
+}
+
+TEST(AsyncLogWriter, givenWritesFromMultipleThreadsWhenFlushedThenAppendsAreWrittenInPerThreadOrder) {
+    std::map<std::string, std::string> files;
+    uint32_t writeCalls = 0;
+    AsyncLogWriter writer([&](const std::string &fileName, const char *data, size_t size, std::ios_base::openmode mode) {
+        files[fileName] += std::string(data, size);
+        writeCalls++;
+    },
+                          AsyncLogWriter::defaultMemoryLimit);
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < 4; threadId++) {
+        threads.emplace_back([&writer, threadId]() {
+            for (uint32_t i = 0; i < 100; i++) {
+                auto line = std::to_string(threadId) + ":" + std::to_string(i) + "\n";
+                writer.write("log" + std::to_string(threadId), line.c_str(), line.size(), std::ios::app);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    writer.write("dump.bin", "\0\1", 2, std::ios::trunc | std::ios::binary);
+    writer.flush();
+
+    EXPECT_EQ(0u, writer.getBufferedBytes());
+    EXPECT_EQ(2u, files["dump.bin"].size());
+    EXPECT_GE(401u, writeCalls);
+    for (uint32_t threadId = 0; threadId < 4; threadId++) {
+        std::string expected;
+        for (uint32_t i = 0; i < 100; i++) {
+            expected += std::to_string(threadId) + ":" + std::to_string(i) + "\n";
+        }
+        EXPECT_EQ(expected, files["log" + std::to_string(threadId)]);
+    }
+}
+
 TEST(FileLogger, WithoutDebugFunctionalityDoesNotCreateLogFile) {
     DebugVariables flags;
     flags.LogApiCalls.set(true);
@@ -7,8 +7,21 @@
 
 #include "shared/offline_compiler/source/multi_command.h"
 
+#include "shared/source/utilities/parallel_for.h"
+
+#include "opencl/source/os_interface/os_inc_base.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
 namespace NEO {
-int MultiCommand::singleBuild(size_t numArgs, const std::vector<std::string> &allArgs) {
+void MultiCommand::singleBuild(size_t numArgs, const std::vector<std::string> &allArgs, const std::string &outFileName, SingleBuildResult &result) {
+    std::ostringstream log;
+    auto buildStart = std::chrono::steady_clock::now();
+
     int retVal = ErrorCode::SUCCESS;
     std::string buildLog;
     OfflineCompiler *pCompiler = OfflineCompiler::create(numArgs, allArgs, true, retVal);
@@ -17,37 +30,105 @@ int MultiCommand::singleBuild(size_t numArgs, const std::vector<std::string> &al
 
         buildLog = pCompiler->getBuildLog();
         if (buildLog.empty() == false) {
-            printf("%s\n", buildLog.c_str());
+            log << buildLog << "\n";
         }
 
         if (retVal == ErrorCode::SUCCESS) {
             if (!pCompiler->isQuiet())
-                printf("Build succeeded.\n");
+                log << "Build succeeded.\n";
         } else {
-            printf("Build failed with error code: %d\n", retVal);
+            log << "Build failed with error code: " << retVal << "\n";
         }
     }
     if (buildLog.empty() == false) {
-        singleBuilds.push_back(pCompiler);
+        result.compilerWithWarnings = pCompiler;
     } else {
         delete pCompiler;
     }
 
+    std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - buildStart;
+    result.buildTimeInMs = buildTime.count();
+    if ((jobsCount > 1) && !quiet) {
+        log << "Build time: " << std::fixed << std::setprecision(2) << result.buildTimeInMs << " ms\n";
+    }
+
     if (outputFileList != "") {
-        std::ofstream myfile(outputFileList, std::fstream::app);
-        if (myfile.is_open()) {
-            if (retVal == ErrorCode::SUCCESS)
-                myfile << getCurrentDirectoryOwn(outDirForBuilds) + OutFileName + ".bin";
-            else
-                myfile << "Unsuccesful build";
-            myfile << std::endl;
-            myfile.close();
-        } else
-            printf("Unable to open outputFileList\n");
+        if (retVal == ErrorCode::SUCCESS)
+            result.outputFileListEntry = getCurrentDirectoryOwn(outDirForBuilds) + outFileName + ".bin";
+        else
+            result.outputFileListEntry = "Unsuccesful build";
+    }
+
+    result.retVal = retVal;
+    result.log += log.str();
+}
+
+void MultiCommand::runBuilds(const std::vector<std::vector<std::string>> &buildsArgs, const std::vector<std::string> &outFileNames) {
+    std::vector<SingleBuildResult> results(buildsArgs.size());
+    std::vector<bool> finished(buildsArgs.size(), false);
+    size_t nextToReport = 0;
+    std::mutex reportMtx;
+
+    // builds may finish in any order, but their logs are printed in the order of commands
+    auto reportFinishedBuilds = [&]() {
+        while ((nextToReport < results.size()) && finished[nextToReport]) {
+            auto &result = results[nextToReport];
+            printf("%s", result.log.c_str());
+            if (result.compilerWithWarnings) {
+                singleBuilds.push_back(result.compilerWithWarnings);
+            }
+            if (outputFileList != "") {
+                std::ofstream myfile(outputFileList, std::fstream::app);
+                if (myfile.is_open()) {
+                    myfile << result.outputFileListEntry;
+                    myfile << std::endl;
+                    myfile.close();
+                } else
+                    printf("Unable to open outputFileList\n");
+            }
+            retValues[nextToReport] = result.retVal;
+            ++nextToReport;
+        }
+    };
+
+    parallelFor(buildsArgs.size(), jobsCount, [&](size_t buildId) {
+        auto &result = results[buildId];
+        if (buildsArgs[buildId].empty()) {
+            // command line could not be parsed, error was already reported
+            result.retVal = retValues[buildId];
+        } else {
+            if (!quiet)
+                result.log = "\nCommand number " + std::to_string(buildId + 1) + ": ";
+            singleBuild(buildsArgs[buildId].size(), buildsArgs[buildId], outFileNames[buildId], result);
+        }
+
+        std::lock_guard<std::mutex> lock(reportMtx);
+        finished[buildId] = true;
+        reportFinishedBuilds();
+    });
+}
+
+int MultiCommand::parseJobsCount(const std::string &jobsArg) {
+    if (jobsArg.empty() || (jobsArg.find_first_not_of("0123456789") != std::string::npos) || (jobsArg.size() > 9)) {
+        printf("Invalid jobs count : %s - should be a non-negative number\n", jobsArg.c_str());
+        return INVALID_COMMAND_LINE;
+    }
+    // more jobs than hardware threads would only oversubscribe the machine
+    auto maxJobsCount = getDefaultWorkersCount();
+    jobsCount = static_cast<size_t>(std::stoul(jobsArg));
+    if ((jobsCount == 0) || (jobsCount > maxJobsCount)) {
+        jobsCount = maxJobsCount;
     }
+    return ErrorCode::SUCCESS;
+}
 
-    return retVal;
+void MultiCommand::preloadCompilerLibraries() {
+    // keep compiler libraries loaded for the whole batch, so that they are not unloaded and reloaded between
+    // single builds; every build still creates its own compiler interface on top of them
+    fclLib.reset(OsLibrary::load(Os::frontEndDllName));
+    igcLib.reset(OsLibrary::load(Os::igcDllName));
 }
+
 MultiCommand::MultiCommand() = default;
 
 MultiCommand::~MultiCommand() {
@@ -127,6 +208,17 @@ int MultiCommand::initialize(const std::vector<std::string> &allArgs) {
             argIndex++;
         } else if (allArgs[argIndex] == "-q") {
             quiet = true;
+        } else if (allArgs[argIndex] == "-j") {
+            if (numArgs > argIndex + 1)
+                retVal = parseJobsCount(allArgs[argIndex + 1]);
+            else {
+                printHelp();
+                return INVALID_COMMAND_LINE;
+            }
+            if (retVal != ErrorCode::SUCCESS) {
+                return retVal;
+            }
+            argIndex++;
         } else if (allArgs[argIndex] == "-output_file_list") {
             if (numArgs > argIndex + 1)
                 outputFileList = allArgs[argIndex + 1];
@@ -148,27 +240,27 @@ int MultiCommand::initialize(const std::vector<std::string> &allArgs) {
     //save file with builds arguments to vector of strings, line by line
     openFileWithBuildsArguments();
     if (!lines.empty()) {
+        std::vector<std::vector<std::string>> buildsArgs(lines.size());
+        std::vector<std::string> outFileNames(lines.size());
+        retValues.assign(lines.size(), ErrorCode::SUCCESS);
         for (unsigned int i = 0; i < lines.size(); i++) {
             std::vector<std::string> singleLineWithArguments;
-            unsigned int numberOfArg;
 
             singleLineWithArguments.push_back(allArgs[0]);
             retVal = splitLineInSeparateArgs(singleLineWithArguments, lines[i], i);
             if (retVal != ErrorCode::SUCCESS) {
-                retValues.push_back(retVal);
+                retValues[i] = retVal;
                 continue;
             }
 
             addAdditionalOptionsToSingleCommandLine(singleLineWithArguments, i);
-
-            numberOfArg = static_cast<unsigned int>(singleLineWithArguments.size());
-
-            if (!quiet)
-                printf("\nCommand number %d: ", i + 1);
-            retVal = singleBuild(numberOfArg, singleLineWithArguments);
-            retValues.push_back(retVal);
+            outFileNames[i] = OutFileName;
+            buildsArgs[i] = std::move(singleLineWithArguments);
         }
 
+        preloadCompilerLibraries();
+        runBuilds(buildsArgs, outFileNames);
+
         return showResults();
     } else {
         printHelp();
@@ -179,7 +271,7 @@ int MultiCommand::initialize(const std::vector<std::string> &allArgs) {
 void MultiCommand::printHelp() {
     printf(R"===(Compiles multiple files using a config file.
 
-Usage: ocloc multi <file_name>
+Usage: ocloc multi <file_name> [-j <jobs>]
   <file_name>   Input file containing a list of arguments for subsequent
                 ocloc invocations.
                 Expected format of each line inside such file is:
@@ -191,6 +283,13 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds to run concurrently.
+                                0 uses all available hardware threads,
+                                larger values are limited to it.
+                                Default is 1 (builds run one by one).
+                                Logs are always printed in the order of
+                                commands in <file_name>.
+
 )===");
 }
 
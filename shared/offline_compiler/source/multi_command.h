@@ -16,6 +16,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 namespace NEO {
 
@@ -34,13 +35,24 @@ class MultiCommand {
     std::string outputFileList = "";
 
   protected:
+    struct SingleBuildResult {
+        int retVal = ErrorCode::SUCCESS;
+        std::string log;
+        std::string outputFileListEntry;
+        OfflineCompiler *compilerWithWarnings = nullptr;
+        double buildTimeInMs = 0.0;
+    };
+
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, int numberOfBuild);
     void openFileWithBuildsArguments();
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, int);
     void printHelp();
     int initialize(const std::vector<std::string> &allArgs);
     int showResults();
-    int singleBuild(size_t numArgs, const std::vector<std::string> &allArgs);
+    void singleBuild(size_t numArgs, const std::vector<std::string> &allArgs, const std::string &outFileName, SingleBuildResult &result);
+    void runBuilds(const std::vector<std::vector<std::string>> &buildsArgs, const std::vector<std::string> &outFileNames);
+    int parseJobsCount(const std::string &jobsArg);
+    void preloadCompilerLibraries();
     std::string eraseExtensionFromPath(std::string &filePath);
     std::string OutFileName;
 
@@ -48,6 +60,10 @@ class MultiCommand {
     std::string pathToCMD;
     std::vector<std::string> lines;
     bool quiet = false;
+    size_t jobsCount = 1U;
+
+    std::unique_ptr<OsLibrary> fclLib;
+    std::unique_ptr<OsLibrary> igcLib;
 
     MultiCommand();
 };
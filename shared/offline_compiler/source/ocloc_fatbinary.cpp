@@ -12,6 +12,7 @@
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "compiler_options.h"
 #include "igfxfmid.h"
@@ -19,6 +20,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace NEO {
@@ -243,34 +246,76 @@ int buildFatbinary(int argc, const char *argv[]) {
         return 1;
     }
 
-    NEO::Ar::ArEncoder fatbinary(true);
+    const size_t targetsCount = targetPlatforms.size();
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers(targetsCount);
+    std::vector<int> retVals(targetsCount, 0);
+    for (size_t targetId = 0; targetId < targetsCount; ++targetId) {
+        argsCopy[deviceArgIndex] = targetPlatforms[targetId].str();
+        compilers[targetId].reset(OfflineCompiler::create(argc, argsCopy, false, retVals[targetId]));
+        if (retVals[targetId] != 0) {
+            printf("Build failed for : %s with error code: %d\n", targetPlatforms[targetId].str().c_str(), retVals[targetId]);
+            return retVals[targetId];
+        }
+    }
 
-    for (auto targetPlatform : targetPlatforms) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = targetPlatform.str();
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argc, argsCopy, false, retVal)};
-        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
-        if (retVal == 0) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+    // Targets with identical frontend inputs share a single source-to-IR translation - the first
+    // of them (frontend leader) runs the full build, all others start from leader's IR
+    std::vector<size_t> frontendLeaders(targetsCount);
+    std::vector<size_t> leaderTargets;
+    std::vector<size_t> followerTargets;
+    std::map<std::string, size_t> leadersByFrontendKey;
+    for (size_t targetId = 0; targetId < targetsCount; ++targetId) {
+        auto frontendKey = compilers[targetId]->getFrontendCompilationKey();
+        frontendLeaders[targetId] = frontendKey.empty() ? targetId : leadersByFrontendKey.emplace(frontendKey, targetId).first->second;
+        if (frontendLeaders[targetId] == targetId) {
+            leaderTargets.push_back(targetId);
+        } else {
+            followerTargets.push_back(targetId);
+        }
+    }
 
-            std::string buildLog = pCompiler->getBuildLog();
-            if (buildLog.empty() == false) {
-                printf("%s\n", buildLog.c_str());
+    auto buildTargets = [&](const std::vector<size_t> &targetIds) {
+        parallelFor(targetIds.size(), getDefaultWorkersCount(), [&](size_t jobId) {
+            auto targetId = targetIds[jobId];
+            auto leaderId = frontendLeaders[targetId];
+            if (leaderId != targetId) {
+                if (retVals[leaderId] != 0) {
+                    retVals[targetId] = retVals[leaderId];
+                    return;
+                }
+                auto leaderIr = compilers[leaderId]->getIntermediateRepresentation();
+                if (false == leaderIr.empty()) {
+                    compilers[targetId]->useIntermediateRepresentation(leaderIr, compilers[leaderId]->isIntermediateRepresentationSpirV());
+                }
             }
+            retVals[targetId] = buildWithSafetyGuard(compilers[targetId].get());
+        });
+    };
+    buildTargets(leaderTargets);
+    buildTargets(followerTargets);
 
-            if (retVal == 0) {
-                if (!pCompiler->isQuiet())
-                    printf("Build succeeded for : %s.\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str());
-            } else {
-                printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
-                printf("Command was:");
-                for (auto i = 0; i < argc; ++i)
-                    printf(" %s", argv[i]);
-                printf("\n");
-            }
+    // report and assemble in target order, so that output does not depend on scheduling
+    NEO::Ar::ArEncoder fatbinary(true);
+    for (size_t targetId = 0; targetId < targetsCount; ++targetId) {
+        auto &pCompiler = compilers[targetId];
+        auto targetPlatform = targetPlatforms[targetId];
+        auto retVal = retVals[targetId];
+        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
+
+        std::string buildLog = pCompiler->getBuildLog();
+        if (buildLog.empty() == false) {
+            printf("%s\n", buildLog.c_str());
         }
 
-        if (0 != retVal) {
+        if (retVal == 0) {
+            if (!pCompiler->isQuiet())
+                printf("Build succeeded for : %s.\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str());
+        } else {
+            printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
+            printf("Command was:");
+            for (auto i = 0; i < argc; ++i)
+                printf(" %s", argv[i]);
+            printf("\n");
             return retVal;
         }
 
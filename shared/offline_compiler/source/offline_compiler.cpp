@@ -204,6 +204,33 @@ int OfflineCompiler::build() {
     return retVal;
 }
 
+std::string OfflineCompiler::getFrontendCompilationKey() const {
+    bool usesFrontend = (false == inputFileLlvm) && (false == inputFileSpirV);
+    if ((false == usesFrontend) || useLlvmText) {
+        // human-readable llvm IR can't be consumed by the backend directly
+        return "";
+    }
+
+    std::string key;
+    key.append(std::to_string(hwInfo->capabilityTable.clVersionSupport));
+    key.append(useLlvmBc ? "\nllvm_bc\n" : "\n");
+    key.append(options);
+    key.append("\n");
+    key.append(internalOptions);
+    return key;
+}
+
+void OfflineCompiler::useIntermediateRepresentation(ArrayRef<const uint8_t> ir, bool irIsSpirV) {
+    UNRECOVERABLE_IF(ir.empty());
+    sourceCode.assign(reinterpret_cast<const char *>(ir.begin()), ir.size());
+    inputFileSpirV = irIsSpirV;
+    inputFileLlvm = (false == irIsSpirV);
+
+    // keep the IR in the output just as if it was produced by this compiler's frontend
+    storeBinary(irBinary, irBinarySize, ir.begin(), ir.size());
+    isSpirV = irIsSpirV;
+}
+
 void OfflineCompiler::updateBuildLog(const char *pErrorString, const size_t errorStringSize) {
     std::string errorString = (errorStringSize && pErrorString) ? std::string(pErrorString, pErrorString + errorStringSize) : "";
     if (errorString[0] != '\0') {
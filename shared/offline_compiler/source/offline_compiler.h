@@ -70,6 +70,17 @@ class OfflineCompiler {
         return *hwInfo;
     }
 
+    ArrayRef<const uint8_t> getIntermediateRepresentation() const {
+        return ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(irBinary), irBinarySize);
+    }
+
+    bool isIntermediateRepresentationSpirV() const {
+        return isSpirV;
+    }
+
+    std::string getFrontendCompilationKey() const;
+    void useIntermediateRepresentation(ArrayRef<const uint8_t> ir, bool irIsSpirV);
+
   protected:
     OfflineCompiler();
 
@@ -11,23 +11,41 @@
 #include <cstdio>
 #include <cstdlib>
 #include <execinfo.h>
+#include <mutex>
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+static thread_local sigjmp_buf jmpbuf;
+static thread_local bool jmpbufSet = false;
 
 class SafetyGuardLinux {
   public:
     SafetyGuardLinux() {
-        struct sigaction sigact;
+        installSignalHandlers();
+    }
+
+    static void installSignalHandlers() {
+        // handlers are process wide, so they are installed once and every thread jumps to its own buffer
+        static std::once_flag handlersInstalled;
+        std::call_once(handlersInstalled, []() {
+            struct sigaction sigact = {};
 
-        sigact.sa_sigaction = sigAction;
-        sigact.sa_flags = SA_RESTART | SA_SIGINFO;
-        sigaction(SIGSEGV, &sigact, (struct sigaction *)NULL);
-        sigaction(SIGILL, &sigact, (struct sigaction *)NULL);
+            sigact.sa_sigaction = sigAction;
+            sigact.sa_flags = SA_RESTART | SA_SIGINFO;
+            sigemptyset(&sigact.sa_mask);
+            sigaction(SIGSEGV, &sigact, (struct sigaction *)NULL);
+            sigaction(SIGILL, &sigact, (struct sigaction *)NULL);
+        });
     }
 
     static void sigAction(int sigNum, siginfo_t *info, void *ucontext) {
+        if (!jmpbufSet) {
+            // fault outside of a guarded call, fall back to default handling
+            signal(sigNum, SIG_DFL);
+            raise(sigNum);
+            return;
+        }
+
         const int callstackDepth = 30;
         void *addresses[callstackDepth];
         char **callstack;
@@ -41,17 +59,21 @@ class SafetyGuardLinux {
         }
 
         free(callstack);
-        longjmp(jmpbuf, 1);
+        siglongjmp(jmpbuf, 1);
     }
 
     template <typename T, typename Object, typename Method>
     T call(Object *object, Method method, T retValueOnCrash) {
         int jump = 0;
-        jump = setjmp(jmpbuf);
+        jump = sigsetjmp(jmpbuf, 1);
 
         if (jump == 0) {
-            return (object->*method)();
+            jmpbufSet = true;
+            T retVal = (object->*method)();
+            jmpbufSet = false;
+            return retVal;
         } else {
+            jmpbufSet = false;
             if (onSigSegv) {
                 onSigSegv();
             } else {
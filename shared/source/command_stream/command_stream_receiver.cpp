@@ -25,6 +25,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/runtime_counters.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 namespace NEO {
@@ -82,6 +83,7 @@ void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
         gfxAllocation.updateTaskCount(submissionTaskCount, osContext->getContextId());
         if (!gfxAllocation.isResident(osContext->getContextId())) {
             this->totalMemoryUsed += gfxAllocation.getUnderlyingBufferSize();
+            RuntimeCounters::increment(RuntimeCounter::bytesMadeResident, gfxAllocation.getUnderlyingBufferSize());
         }
     }
     gfxAllocation.updateResidencyTaskCount(submissionTaskCount, osContext->getContextId());
@@ -126,6 +128,11 @@ void CommandStreamReceiver::waitForTaskCountAndCleanAllocationList(uint32_t requ
 
 void CommandStreamReceiver::waitForTaskCountAndCleanTemporaryAllocationList(uint32_t requiredTaskCount) {
     waitForTaskCountAndCleanAllocationList(requiredTaskCount, TEMPORARY_ALLOCATION);
+
+    if (scratchSpaceController) {
+        auto lock = obtainUniqueOwnership();
+        scratchSpaceController->releaseIdleScratchSpace(this->taskCount);
+    }
 };
 
 void CommandStreamReceiver::ensureCommandBufferAllocation(LinearStream &commandStream, size_t minimumRequiredSize, size_t additionalAllocationSize) {
@@ -215,7 +222,9 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
     }
 
     time1 = std::chrono::high_resolution_clock::now();
+    bool waited = false;
     while (*getTagAddress() < taskCountToWait && timeDiff <= timeoutMicroseconds) {
+        waited = true;
         std::this_thread::yield();
         CpuIntrinsics::pause();
 
@@ -224,6 +233,10 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
             timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
         }
     }
+    if (waited) {
+        auto spinTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - time1).count();
+        RuntimeCounters::increment(RuntimeCounter::waitSpinTimeNs, static_cast<uint64_t>(spinTime));
+    }
     if (*getTagAddress() >= taskCountToWait) {
         return true;
     }
@@ -28,7 +28,9 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/runtime_counters.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "command_stream_receiver_hw_ext.inl"
 
@@ -153,6 +155,8 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     typedef typename GfxFamily::MI_BATCH_BUFFER_END MI_BATCH_BUFFER_END;
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     typedef typename GfxFamily::STATE_BASE_ADDRESS STATE_BASE_ADDRESS;
+    TraceRecorderScope traceRecorderScope(TraceCategory::submission, "flushTask");
+    RuntimeCounters::increment(RuntimeCounter::flushTasks);
 
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
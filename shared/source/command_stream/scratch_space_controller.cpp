@@ -7,12 +7,14 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
 ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
@@ -20,11 +22,18 @@ ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, Executi
     auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
     auto &hwHelper = HwHelper::get(hwInfo->platform.eRenderCoreFamily);
     computeUnitsUsedForScratch = hwHelper.getComputeUnitsUsedForScratch(hwInfo);
+    if (ScratchSpacePool::isPoolingEnabled()) {
+        scratchSpacePool = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getScratchSpacePool(rootDeviceIndex);
+    }
 }
 
 ScratchSpaceController::~ScratchSpaceController() {
     if (scratchAllocation) {
-        getMemoryManager()->freeGraphicsMemory(scratchAllocation);
+        if (scratchSpacePool) {
+            scratchSpacePool->releaseAllocation(scratchAllocation);
+        } else {
+            getMemoryManager()->freeGraphicsMemory(scratchAllocation);
+        }
     }
     if (privateScratchAllocation) {
         getMemoryManager()->freeGraphicsMemory(privateScratchAllocation);
@@ -35,4 +44,32 @@ MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
 }
+
+GraphicsAllocation *ScratchSpaceController::obtainScratchAllocation(size_t size, OsContext &osContext) {
+    if (scratchSpacePool) {
+        return scratchSpacePool->obtainAllocation(size, osContext.getContextId());
+    }
+    return getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, size, GraphicsAllocation::AllocationType::SCRATCH_SURFACE});
+}
+
+void ScratchSpaceController::releaseScratchAllocation(GraphicsAllocation *allocation) {
+    if (scratchSpacePool) {
+        scratchSpacePool->releaseAllocation(allocation);
+    } else {
+        csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION);
+    }
+}
+
+void ScratchSpaceController::releaseIdleScratchSpace(uint32_t currentTaskCount) {
+    // without pool, scratch space is kept by command stream receiver until it needs a bigger one
+    if (!scratchSpacePool || !scratchAllocation) {
+        return;
+    }
+    if (currentTaskCount - lastScratchUseTaskCount < ScratchSpacePool::getIdleTaskCountBeforeRelease()) {
+        return;
+    }
+    releaseScratchAllocation(scratchAllocation);
+    scratchAllocation = nullptr;
+    scratchSizeBytes = 0;
+}
 } // namespace NEO
@@ -20,6 +20,7 @@ class InternalAllocationStorage;
 class MemoryManager;
 struct HardwareInfo;
 class OsContext;
+class ScratchSpacePool;
 
 namespace ScratchSpaceConstants {
 constexpr size_t scratchSpaceOffsetFor64Bit = 4096u;
@@ -48,17 +49,24 @@ class ScratchSpaceController {
 
     virtual void reserveHeap(IndirectHeap::Type heapType, IndirectHeap *&indirectHeap) = 0;
 
+    void releaseIdleScratchSpace(uint32_t currentTaskCount);
+    ScratchSpacePool *peekScratchSpacePool() const { return scratchSpacePool; }
+
   protected:
     MemoryManager *getMemoryManager() const;
+    GraphicsAllocation *obtainScratchAllocation(size_t size, OsContext &osContext);
+    void releaseScratchAllocation(GraphicsAllocation *allocation);
 
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
     GraphicsAllocation *scratchAllocation = nullptr;
     GraphicsAllocation *privateScratchAllocation = nullptr;
     InternalAllocationStorage &csrAllocationStorage;
+    ScratchSpacePool *scratchSpacePool = nullptr;
     size_t scratchSizeBytes = 0;
     size_t privateScratchSizeBytes = 0;
     bool force32BitAllocation = false;
     uint32_t computeUnitsUsedForScratch = 0;
+    uint32_t lastScratchUseTaskCount = 0;
 };
 } // namespace NEO
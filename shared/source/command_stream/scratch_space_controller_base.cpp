@@ -30,13 +30,16 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
                                                          bool &stateBaseAddressDirty,
                                                          bool &vfeStateDirty) {
     size_t requiredScratchSizeInBytes = requiredPerThreadScratchSize * computeUnitsUsedForScratch;
+    if (requiredScratchSizeInBytes) {
+        lastScratchUseTaskCount = currentTaskCount;
+    }
     if (requiredScratchSizeInBytes && (!scratchAllocation || scratchSizeBytes < requiredScratchSizeInBytes)) {
         if (scratchAllocation) {
             scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-            csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            releaseScratchAllocation(scratchAllocation);
         }
         scratchSizeBytes = requiredScratchSizeInBytes;
-        createScratchSpaceAllocation();
+        createScratchSpaceAllocation(osContext);
         vfeStateDirty = true;
         force32BitAllocation = getMemoryManager()->peekForce32BitAllocations();
         if (is64bit && !force32BitAllocation) {
@@ -45,8 +48,8 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
     }
 }
 
-void ScratchSpaceControllerBase::createScratchSpaceAllocation() {
-    scratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, scratchSizeBytes, GraphicsAllocation::AllocationType::SCRATCH_SURFACE});
+void ScratchSpaceControllerBase::createScratchSpaceAllocation(OsContext &osContext) {
+    scratchAllocation = obtainScratchAllocation(scratchSizeBytes, osContext);
     UNRECOVERABLE_IF(scratchAllocation == nullptr);
 }
 
@@ -27,6 +27,6 @@ class ScratchSpaceControllerBase : public ScratchSpaceController {
     void reserveHeap(IndirectHeap::Type heapType, IndirectHeap *&indirectHeap) override;
 
   protected:
-    void createScratchSpaceAllocation();
+    void createScratchSpaceAllocation(OsContext &osContext);
 };
 } // namespace NEO
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_pool.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+namespace NEO {
+ScratchSpacePool::ScratchSpacePool(uint32_t rootDeviceIndex, MemoryManager &memoryManager)
+    : rootDeviceIndex(rootDeviceIndex), memoryManager(memoryManager) {
+    if (DebugManager.flags.ScratchSpacePoolMaxCachedSizeInKb.get() != -1) {
+        maxCachedSize = static_cast<size_t>(DebugManager.flags.ScratchSpacePoolMaxCachedSizeInKb.get()) * MemoryConstants::kiloByte;
+    }
+}
+
+ScratchSpacePool::~ScratchSpacePool() {
+    // all command stream receivers are already destroyed, so nothing can use cached allocations
+    for (auto allocation : cachedAllocations) {
+        memoryManager.freeGraphicsMemory(allocation);
+    }
+}
+
+bool ScratchSpacePool::isPoolingEnabled() {
+    return DebugManager.flags.EnableScratchSpacePool.get() == 1;
+}
+
+uint32_t ScratchSpacePool::getIdleTaskCountBeforeRelease() {
+    if (DebugManager.flags.ScratchSpaceIdleTaskCountBeforeRelease.get() != -1) {
+        return static_cast<uint32_t>(DebugManager.flags.ScratchSpaceIdleTaskCountBeforeRelease.get());
+    }
+    return defaultIdleTaskCountBeforeRelease;
+}
+
+GraphicsAllocation *ScratchSpacePool::obtainAllocation(size_t size, uint32_t contextId) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto bestFit = cachedAllocations.end();
+    for (auto it = cachedAllocations.begin(); it != cachedAllocations.end(); it++) {
+        auto allocationSize = (*it)->getUnderlyingBufferSize();
+        if (allocationSize < size || isBusyOnOtherContexts(**it, contextId)) {
+            continue;
+        }
+        if (bestFit == cachedAllocations.end() || allocationSize < (*bestFit)->getUnderlyingBufferSize()) {
+            bestFit = it;
+        }
+    }
+
+    if (bestFit != cachedAllocations.end()) {
+        auto allocation = *bestFit;
+        cachedAllocations.erase(bestFit);
+        cachedMemorySize -= allocation->getUnderlyingBufferSize();
+        reusesCount++;
+        DBG_LOG(PrintDebugMessages, __FUNCTION__, "Reused scratch allocation of size ", allocation->getUnderlyingBufferSize(), " for requested size ", size);
+        return allocation;
+    }
+
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties({rootDeviceIndex, size, GraphicsAllocation::AllocationType::SCRATCH_SURFACE});
+    if (allocation == nullptr) {
+        // drop allocations that are not needed anymore and try once again
+        trimLocked(0u);
+        allocation = memoryManager.allocateGraphicsMemoryWithProperties({rootDeviceIndex, size, GraphicsAllocation::AllocationType::SCRATCH_SURFACE});
+        if (allocation == nullptr) {
+            return nullptr;
+        }
+    }
+    heldMemorySize += allocation->getUnderlyingBufferSize();
+    allocationsCount++;
+    DBG_LOG(PrintDebugMessages, __FUNCTION__, "Created scratch allocation of size ", size, ", scratch memory held: ", heldMemorySize);
+    return allocation;
+}
+
+void ScratchSpacePool::releaseAllocation(GraphicsAllocation *allocation) {
+    std::lock_guard<std::mutex> lock(mtx);
+    cachedAllocations.push_back(allocation);
+    cachedMemorySize += allocation->getUnderlyingBufferSize();
+    trimLocked(maxCachedSize);
+}
+
+void ScratchSpacePool::trim(size_t maxCachedSize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimLocked(maxCachedSize);
+}
+
+void ScratchSpacePool::trimLocked(size_t maxCachedSize) {
+    for (auto it = cachedAllocations.begin(); it != cachedAllocations.end() && cachedMemorySize > maxCachedSize;) {
+        auto allocation = *it;
+        auto allocationSize = allocation->getUnderlyingBufferSize();
+        cachedMemorySize -= allocationSize;
+        heldMemorySize -= allocationSize;
+        it = cachedAllocations.erase(it);
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    }
+}
+
+bool ScratchSpacePool::isBusyOnOtherContexts(GraphicsAllocation &allocation, uint32_t contextId) const {
+    // work submitted to the same context is executed in order, so only other contexts may still use the allocation
+    for (auto &engine : memoryManager.getRegisteredEnginesSnapshot()) {
+        auto osContextId = engine.osContext->getContextId();
+        if (osContextId != contextId &&
+            allocation.isUsedByOsContext(osContextId) &&
+            allocation.getTaskCount(osContextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace NEO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+
+// Root device level storage of scratch space allocations.
+// Allocations returned by command stream receivers are kept until they are idle on GPU
+// and then can be handed out to any other command stream receiver of the same root device.
+class ScratchSpacePool {
+  public:
+    static constexpr size_t defaultMaxCachedSize = 128 * MemoryConstants::megaByte;
+    static constexpr uint32_t defaultIdleTaskCountBeforeRelease = 16u;
+
+    ScratchSpacePool(uint32_t rootDeviceIndex, MemoryManager &memoryManager);
+    MOCKABLE_VIRTUAL ~ScratchSpacePool();
+
+    static bool isPoolingEnabled();
+    static uint32_t getIdleTaskCountBeforeRelease();
+
+    GraphicsAllocation *obtainAllocation(size_t size, uint32_t contextId);
+    void releaseAllocation(GraphicsAllocation *allocation);
+    void trim(size_t maxCachedSize);
+
+    size_t getHeldMemorySize() const { return heldMemorySize; }
+    size_t getCachedMemorySize() const { return cachedMemorySize; }
+    size_t getCachedAllocationsCount() const { return cachedAllocations.size(); }
+    uint64_t getAllocationsCount() const { return allocationsCount; }
+    uint64_t getReusesCount() const { return reusesCount; }
+
+  protected:
+    void trimLocked(size_t maxCachedSize);
+    MOCKABLE_VIRTUAL bool isBusyOnOtherContexts(GraphicsAllocation &allocation, uint32_t contextId) const;
+
+    const uint32_t rootDeviceIndex;
+    MemoryManager &memoryManager;
+    size_t maxCachedSize = defaultMaxCachedSize;
+    // ordered from the least recently released
+    std::vector<GraphicsAllocation *> cachedAllocations;
+    size_t heldMemorySize = 0;
+    size_t cachedMemorySize = 0;
+    uint64_t allocationsCount = 0;
+    uint64_t reusesCount = 0;
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/debug_settings_reader.h"
+#include "shared/source/utilities/runtime_counters.h"
 
 #include "config.h"
 #include "os_inc.h"
@@ -25,15 +26,20 @@
 namespace NEO {
 std::mutex CompilerCache::cacheAccessMtx;
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
-                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const ArrayRef<const char> compilerRevision) {
     Hash hash;
+    auto updateWithRange = [&hash](const ArrayRef<const char> range) {
+        hash.update("----", 4);
+        if (false == range.empty()) {
+            hash.update(range.begin(), range.size());
+        }
+    };
 
-    hash.update("----", 4);
-    hash.update(&*input.begin(), input.size());
-    hash.update("----", 4);
-    hash.update(&*options.begin(), options.size());
-    hash.update("----", 4);
-    hash.update(&*internalOptions.begin(), internalOptions.size());
+    updateWithRange(input);
+    updateWithRange(options);
+    updateWithRange(internalOptions);
+    updateWithRange(compilerRevision);
 
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
@@ -67,7 +73,9 @@ std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernel
     std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
 
     std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    auto cachedBinary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    RuntimeCounters::increment(cachedBinary ? RuntimeCounter::compilerCacheHits : RuntimeCounter::compilerCacheMisses);
+    return cachedBinary;
 }
 
 } // namespace NEO
@@ -27,7 +27,8 @@ struct CompilerCacheConfig {
 class CompilerCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
-                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                               ArrayRef<const char> compilerRevision = {});
 
     CompilerCache(const CompilerCacheConfig &config);
     virtual ~CompilerCache() = default;
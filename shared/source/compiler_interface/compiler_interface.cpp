@@ -24,6 +24,8 @@
 #include "ocl_igc_interface/platform_helper.h"
 
 #include <fstream>
+#include <sstream>
+#include <sys/stat.h>
 
 namespace NEO {
 SpinLock CompilerInterface::spinlock;
@@ -69,7 +71,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
                                                           input.src,
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(compilerRevision.c_str(), compilerRevision.size()));
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
@@ -115,7 +118,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cachingMode == CachingMode::PreProcess) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          ArrayRef<const char>(compilerRevision.c_str(), compilerRevision.size()));
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
@@ -305,6 +309,23 @@ TranslationOutput::ErrorCode CompilerInterface::getSipKernelBinary(NEO::Device &
     const char *sipSrc = getSipLlSrc(device);
     std::string sipInternalOptions = getSipKernelCompilerInternalOptions(type);
 
+    // sip type is reflected in internal options, so cached binaries of different sip kernels don't collide,
+    // compiler revision invalidates binaries built by other compiler versions
+    std::string kernelFileHash;
+    if (cache) {
+        kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
+                                                          ArrayRef<const char>(sipSrc, strlen(sipSrc)),
+                                                          ArrayRef<const char>(),
+                                                          ArrayRef<const char>(sipInternalOptions.c_str(), sipInternalOptions.size()),
+                                                          ArrayRef<const char>(compilerRevision.c_str(), compilerRevision.size()));
+        size_t cachedBinarySize = 0u;
+        auto cachedBinary = cache->loadCachedBinary(kernelFileHash, cachedBinarySize);
+        if (cachedBinary && (cachedBinarySize > 0u)) {
+            retBinary.assign(cachedBinary.get(), cachedBinary.get() + cachedBinarySize);
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     auto igcSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), sipSrc, strlen(sipSrc) + 1);
     auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), nullptr, 0);
     auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), sipInternalOptions.c_str(), sipInternalOptions.size() + 1);
@@ -319,6 +340,9 @@ TranslationOutput::ErrorCode CompilerInterface::getSipKernelBinary(NEO::Device &
     }
 
     retBinary.assign(igcOutput->GetOutput()->GetMemory<char>(), igcOutput->GetOutput()->GetMemory<char>() + igcOutput->GetOutput()->GetSizeRaw());
+    if (cache) {
+        cache->cacheBinary(kernelFileHash, retBinary.data(), static_cast<uint32_t>(retBinary.size()));
+    }
     return TranslationOutput::ErrorCode::Success;
 }
 
@@ -331,10 +355,26 @@ bool CompilerInterface::loadIgc() {
     return NEO::loadCompiler<IGC::IgcOclDeviceCtx>(Os::igcDllName, igcLib, igcMain);
 }
 
+std::string CompilerInterface::getLibraryRevision(OsLibrary *library, CIF::CIFMain *libraryMain) {
+    std::stringstream revision;
+    if (libraryMain != nullptr) {
+        revision << libraryMain->GetBinaryVersion();
+    }
+    auto fullPath = (library != nullptr) ? library->getFullPath() : std::string();
+    revision << ":" << fullPath;
+    struct stat fileStat = {};
+    if ((false == fullPath.empty()) && (stat(fullPath.c_str(), &fileStat) == 0)) {
+        // size and modification time change whenever the library is replaced with another build
+        revision << ":" << fileStat.st_size << ":" << fileStat.st_mtime;
+    }
+    return revision.str();
+}
+
 bool CompilerInterface::initialize(std::unique_ptr<CompilerCache> cache, bool requireFcl) {
     bool fclAvailable = requireFcl ? this->loadFcl() : false;
     bool igcAvailable = this->loadIgc();
 
+    compilerRevision = getLibraryRevision(igcLib.get(), igcMain.get()) + ";" + getLibraryRevision(fclLib.get(), fclMain.get());
     this->cache.swap(cache);
 
     return this->cache && igcAvailable && (fclAvailable || (false == requireFcl));
@@ -147,6 +147,9 @@ class CompilerInterface {
         return std::unique_lock<SpinLock>{spinlock};
     }
     std::unique_ptr<CompilerCache> cache = nullptr;
+    // identifies loaded compiler libraries, part of every cache key
+    std::string compilerRevision;
+    static std::string getLibraryRevision(OsLibrary *library, CIF::CIFMain *libraryMain);
 
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using fclDevCtxUptr = CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL>;
@@ -17,6 +17,8 @@ DECLARE_DEBUG_VARIABLE(std::string, AUBDumpFilterKernelName, std::string("unk"),
 DECLARE_DEBUG_VARIABLE(std::string, AUBDumpToggleFileName, std::string("unk"), "Name of file to save AUB in toggle mode")
 DECLARE_DEBUG_VARIABLE(std::string, OverrideGdiPath, std::string("unk"), "When different value than \"unk\", will override default path to gdi library.")
 DECLARE_DEBUG_VARIABLE(std::string, AubDumpAddMmioRegistersList, std::string("unk"), "Semicolon separated sequence of additional MMIO registers offset;values pairs i.e. 0x111;0x123;0x222;0x456")
+DECLARE_DEBUG_VARIABLE(std::string, TraceRecorderOutputFile, std::string("neo_trace.json"), "Name of file the trace recorder timeline is exported to at process exit or on SIGUSR2")
+DECLARE_DEBUG_VARIABLE(std::string, RuntimeCountersOutputFile, std::string("neo_runtime_counters.txt"), "Name of file runtime counters are dumped to at process exit when DumpRuntimeCounters is enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterNamedKernelStartIdx, 0, "Start index of named kernel to AUB capture")
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterNamedKernelEndIdx, -1, "End index of named kernel to AUB capture")
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpSubCaptureMode, 0, "AUB dump subcapture mode (0 - off, 1 - filter by kernel name and/or index range, 2 - toggle on/off with dynamic regkey)")
@@ -71,6 +73,8 @@ DECLARE_DEBUG_VARIABLE(bool, LogPatchTokens, false, "Enables logging patch token
 DECLARE_DEBUG_VARIABLE(bool, LogTaskCounts, false, "Enables logging taskCounts and taskLevels to file")
 DECLARE_DEBUG_VARIABLE(bool, LogAlignedAllocations, false, "Logs alignedMalloc and alignedFree allocations")
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationMemoryPool, false, "Logs memory pool for allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncFileLogging, -1, "Buffer logs and dumps per thread and write them to files from a background thread: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncFileLoggingMemoryLimitInKb, -1, "Limit of buffered data for async file logging, writes above the limit are dropped: -1 - default (16384), >0 - limit in KB")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
@@ -88,6 +92,7 @@ DECLARE_DEBUG_VARIABLE(bool, Force32bitAddressing, false, "Forces 32 bit address
 DECLARE_DEBUG_VARIABLE(bool, ForceCsrFlushing, false, "Forces flushing of command stream receiver")
 DECLARE_DEBUG_VARIABLE(bool, ForceCsrReprogramming, false, "Forces reprogramming of command stream receiver")
 DECLARE_DEBUG_VARIABLE(bool, OmitTimestampPacketDependencies, false, "Clears all node dependences on timestamp packet")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampPacketDependencyPruning, -1, "Skip semaphores for timestamp packet dependencies that are completed, duplicated or implied by later node from the same queue: -1 - default (enabled), 0 - disabled, 1 - enabled")
 DECLARE_DEBUG_VARIABLE(bool, DisableStatelessToStatefulOptimization, false, "Disables stateless to stateful optimization for buffers")
 DECLARE_DEBUG_VARIABLE(bool, DisableConcurrentBlockExecution, false, "disables concurrent block kernel execution")
 DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passes flag to KMD that informs KMD to not emit any ring buffer flushes.")
@@ -95,6 +100,31 @@ DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active a
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableDcFlushInEpilogue, false, "Disable DC flush in epilogue")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrTracking, -1, "Enable host ptr tracking: -1 - default platform setting, 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUserptrBoCache, -1, "Reuse host memory, userptr BOs and GPU VA ranges of freed system memory allocations: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrBoCacheMaxSizeInKb, -1, "Maximum size of idle allocations kept in userptr BO cache: -1 - default (64MB), >=0 - size in KB")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrBoCacheIdleTimeoutMs, -1, "Time after which idle userptr BO cache entries are released: -1 - default (1000ms), >=0 - time in ms")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHugePageAllocations, -1, "Back large system memory allocations with 2MB aligned memory advised for transparent huge pages: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, HugePageAllocationThresholdInKb, -1, "Minimal size of allocation backed with huge pages: -1 - default (2MB), >=0 - size in KB")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSmallBufferPool, -1, "Suballocate small buffers of a context from shared pool allocations: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, SmallBufferPoolMaxBufferSize, -1, "Maximal size of buffer suballocated from small buffer pool: -1 - default (64KB), >=0 - size in bytes")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableScratchSpacePool, -1, "Share scratch space allocations between command stream receivers of a root device and release them when unused: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ScratchSpacePoolMaxCachedSizeInKb, -1, "Maximum size of unused scratch space allocations kept in scratch space pool: -1 - default (128MB), >=0 - size in KB")
+DECLARE_DEBUG_VARIABLE(int32_t, ScratchSpaceIdleTaskCountBeforeRelease, -1, "Number of tasks submitted without scratch space after which waiting command stream receiver returns its scratch space to the pool: -1 - default (16), >=0 - task count")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImageResourceCache, -1, "Reuse image resource parameters computed by GmmLib for images with identical format and descriptor: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ImageResourceCacheMaxEntries, -1, "Maximum number of entries in image resource cache: -1 - default (256), >=0 - entries count")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCommandSequenceSingleSubmission, -1, "Replay recorded command sequence with a single submission of all its walkers: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelArgPatchPlan, -1, "Patch immediate kernel arguments using copy operations precompiled per kernel info: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelMemcpy, -1, "Split large CPU transfers between multiple worker threads: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelMemcpyMinSizeInKb, -1, "Minimal size of CPU transfer that is split between worker threads: -1 - default (4096), >=0 - size in KB")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelMemcpyUseNonTemporalStores, -1, "Use non-temporal stores in CPU transfers split between worker threads: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeferredBufferObjectClose, -1, "Close buffer objects of freed allocations and release their GPU VA ranges in batches on gem close worker thread: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, PageFaultManagerChunkSizeInKb, -1, "Granularity of shared unified memory migration for allocations bigger than one chunk: -1 - default (whole allocation is migrated at once), 0 - whole allocation is migrated at once, >0 - chunk size in KB aligned up to page size, chunks read by cpu stay read only until written")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyEngineCreation, -1, "Create only default engine during device initialization and remaining engines with their command stream receivers on first use: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelPlatformInitialization, -1, "Initialize root devices (ClDevice and SIP kernel) in parallel during platform initialization: -1 - default (enabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTraceRecorder, -1, "Record API, submission and GPU spans into per-thread buffers and export them as Chrome trace JSON: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, TraceRecorderRecordsPerThread, -1, "Number of records kept per thread by trace recorder, oldest records are overwritten: -1 - default (65536), >0 - records count")
+DECLARE_DEBUG_VARIABLE(int32_t, DumpRuntimeCounters, -1, "Dump runtime counters to RuntimeCountersOutputFile at process exit: -1 - default (disabled), 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeferredHostSideTracing, -1, "Buffer host side tracing calls per thread and deliver them to callbacks from a collector thread, callbacks get return value but no function params: -1 - default (disabled), 0 - disabled, 1 - enabled")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -147,6 +177,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideThreadArbitrationPolicy, -1, "-1 (dont o
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideAubDeviceId, -1, "-1 dont override, any other: use this value for AUB generation device id")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampPacket, -1, "-1: default, 0: disable, 1:enable. Write Timestamp Packet for each set of gpu walkers")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelIsaAllocation, -1, "-1: default (disabled), 0: disable, 1: enable. Kernel ISA allocations are created on first kernel creation instead of during program build")
 DECLARE_DEBUG_VARIABLE(int32_t, AllocateSharedAllocationsWithCpuAndGpuStorage, -1, "When enabled driver creates cpu & gpu storage for shared unified memory allocations. (-1 - devices default mode, 0 - disable, 1 - enable)")
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU tiemstamps instead of calculated ones.")
@@ -40,7 +40,9 @@ Device::~Device() {
     }
 
     for (auto &engine : engines) {
-        engine.commandStreamReceiver->flushBatchedSubmissions();
+        if (engine.commandStreamReceiver) {
+            engine.commandStreamReceiver->flushBatchedSubmissions();
+        }
     }
 
     commandStreamReceivers.clear();
@@ -62,7 +64,16 @@ bool Device::createDeviceImpl() {
     if (!createEngines()) {
         return false;
     }
-    executionEnvironment->memoryManager->setDefaultEngineIndex(defaultEngineIndex);
+    if (engineCreationFlags) {
+        auto registeredEngines = executionEnvironment->memoryManager->getRegisteredEnginesSnapshot();
+        for (uint32_t engineIndex = 0; engineIndex < registeredEngines.size(); engineIndex++) {
+            if (registeredEngines[engineIndex].commandStreamReceiver == getDefaultEngine().commandStreamReceiver) {
+                executionEnvironment->memoryManager->setDefaultEngineIndex(engineIndex);
+            }
+        }
+    } else {
+        executionEnvironment->memoryManager->setDefaultEngineIndex(defaultEngineIndex);
+    }
 
     auto osInterface = getRootDeviceEnvironment().osInterface.get();
 
@@ -81,20 +92,47 @@ bool Device::createDeviceImpl() {
 
     executionEnvironment->memoryManager->setForce32BitAllocations(getDeviceInfo().force32BitAddressess);
 
-    if (DebugManager.flags.EnableExperimentalCommandBuffer.get() > 0) {
-        for (auto &engine : engines) {
-            auto csr = engine.commandStreamReceiver;
-            csr->setExperimentalCmdBuffer(std::make_unique<ExperimentalCommandBuffer>(csr, getDeviceInfo().profilingTimerResolution));
+    for (auto &engine : engines) {
+        if (engine.commandStreamReceiver) {
+            setupExperimentalCommandBuffer(*engine.commandStreamReceiver);
         }
     }
 
     return true;
 }
 
+void Device::setupExperimentalCommandBuffer(CommandStreamReceiver &commandStreamReceiver) {
+    if (DebugManager.flags.EnableExperimentalCommandBuffer.get() > 0) {
+        commandStreamReceiver.setExperimentalCmdBuffer(std::make_unique<ExperimentalCommandBuffer>(&commandStreamReceiver, getDeviceInfo().profilingTimerResolution));
+    }
+}
+
 bool Device::createEngines() {
     auto &hwInfo = getHardwareInfo();
     auto gpgpuEngines = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getGpgpuEngineInstances(hwInfo);
 
+    if (DebugManager.flags.EnableLazyEngineCreation.get() == 1) {
+        // only default engine is created now, remaining ones are created on first use
+        engineInstances.assign(gpgpuEngines.begin(), gpgpuEngines.end());
+        engines.resize(gpgpuEngines.size());
+        engineCreationFlags = std::make_unique<std::once_flag[]>(gpgpuEngines.size());
+
+        auto defaultEngineType = getChosenEngineType(hwInfo);
+        for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < gpgpuEngines.size(); deviceCsrIndex++) {
+            if (gpgpuEngines[deviceCsrIndex] == defaultEngineType &&
+                deviceCsrIndex != HwHelper::lowPriorityGpgpuEngineIndex &&
+                deviceCsrIndex != HwHelper::internalUsageEngineIndex) {
+                defaultEngineIndex = deviceCsrIndex;
+            }
+        }
+
+        bool engineCreated = false;
+        std::call_once(engineCreationFlags[defaultEngineIndex], [&]() {
+            engineCreated = createEngine(defaultEngineIndex, gpgpuEngines[defaultEngineIndex]);
+        });
+        return engineCreated;
+    }
+
     for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < gpgpuEngines.size(); deviceCsrIndex++) {
         if (!createEngine(deviceCsrIndex, gpgpuEngines[deviceCsrIndex])) {
             return false;
@@ -148,12 +186,29 @@ bool Device::createEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engine
         return false;
     }
 
+    if (engineCreationFlags) {
+        std::lock_guard<std::mutex> lock(engineCreationMutex);
+        engines[deviceCsrIndex] = {commandStreamReceiver.get(), osContext};
+        commandStreamReceivers.push_back(std::move(commandStreamReceiver));
+        return true;
+    }
     engines.push_back({commandStreamReceiver.get(), osContext});
     commandStreamReceivers.push_back(std::move(commandStreamReceiver));
 
     return true;
 }
 
+EngineControl &Device::obtainEngine(uint32_t deviceCsrIndex) {
+    if (engineCreationFlags) {
+        std::call_once(engineCreationFlags[deviceCsrIndex], [&]() {
+            auto engineCreated = createEngine(deviceCsrIndex, engineInstances[deviceCsrIndex]);
+            UNRECOVERABLE_IF(!engineCreated);
+            setupExperimentalCommandBuffer(*engines[deviceCsrIndex].commandStreamReceiver);
+        });
+    }
+    return engines[deviceCsrIndex];
+}
+
 const HardwareInfo &Device::getHardwareInfo() const { return *getRootDeviceEnvironment().getHardwareInfo(); }
 
 const DeviceInfo &Device::getDeviceInfo() const {
@@ -177,7 +232,7 @@ bool Device::isSimulation() const {
     auto &hwInfo = getHardwareInfo();
 
     bool simulation = hwInfo.capabilityTable.isSimulation(hwInfo.platform.usDeviceID);
-    if (engines[0].commandStreamReceiver->getType() != CommandStreamReceiverType::CSR_HW) {
+    if (getDefaultEngine().commandStreamReceiver->getType() != CommandStreamReceiverType::CSR_HW) {
         simulation = true;
     }
     if (hwInfo.featureTable.ftrSimulationMode) {
@@ -201,6 +256,18 @@ bool Device::isDebuggerActive() const {
 }
 
 EngineControl &Device::getEngine(aub_stream::EngineType engineType, bool lowPriority) {
+    if (engineCreationFlags) {
+        for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < engineInstances.size(); deviceCsrIndex++) {
+            if (engineInstances[deviceCsrIndex] == engineType &&
+                (deviceCsrIndex == HwHelper::lowPriorityGpgpuEngineIndex) == lowPriority) {
+                return obtainEngine(deviceCsrIndex);
+            }
+        }
+        if (DebugManager.flags.OverrideInvalidEngineWithDefault.get()) {
+            return getDefaultEngine();
+        }
+        UNRECOVERABLE_IF(true);
+    }
     for (auto &engine : engines) {
         if (engine.osContext->getEngineType() == engineType &&
             engine.osContext->isLowPriority() == lowPriority) {
@@ -15,6 +15,8 @@
 #include "opencl/source/device/device_info.h"
 #include "opencl/source/os_interface/performance_counters.h"
 
+#include <mutex>
+
 namespace NEO {
 class DriverInfo;
 class OSTime;
@@ -101,6 +103,8 @@ class Device : public ReferenceTrackedObject<Device> {
     virtual bool createDeviceImpl();
     virtual bool createEngines();
     bool createEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType);
+    EngineControl &obtainEngine(uint32_t deviceCsrIndex);
+    void setupExperimentalCommandBuffer(CommandStreamReceiver &commandStreamReceiver);
     MOCKABLE_VIRTUAL std::unique_ptr<CommandStreamReceiver> createCommandStreamReceiver() const;
 
     unsigned int enabledClVersion = 0u;
@@ -116,6 +120,9 @@ class Device : public ReferenceTrackedObject<Device> {
     std::unique_ptr<PerformanceCounters> performanceCounters;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     std::vector<EngineControl> engines;
+    std::vector<aub_stream::EngineType> engineInstances;
+    std::unique_ptr<std::once_flag[]> engineCreationFlags;
+    std::mutex engineCreationMutex;
     PreemptionMode preemptionMode;
     ExecutionEnvironment *executionEnvironment = nullptr;
     uint32_t defaultEngineIndex = 0;
@@ -12,9 +12,9 @@
 namespace NEO {
 
 EngineControl &Device::getInternalEngine() {
-    if (this->engines[0].commandStreamReceiver->getType() != CommandStreamReceiverType::CSR_HW) {
+    if (this->getDefaultEngine().commandStreamReceiver->getType() != CommandStreamReceiverType::CSR_HW) {
         return this->getDefaultEngine();
     }
-    return this->getDeviceById(0)->engines[HwHelper::internalUsageEngineIndex];
+    return this->getDeviceById(0)->obtainEngine(HwHelper::internalUsageEngineIndex);
 }
 } // namespace NEO
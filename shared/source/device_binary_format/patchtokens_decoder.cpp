@@ -11,6 +11,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include <algorithm>
 
@@ -18,6 +19,8 @@ namespace NEO {
 
 namespace PatchTokenBinary {
 
+size_t minKernelsCountForParallelDecode = 64U;
+
 struct PatchTokensStreamReader {
     const ArrayRef<const uint8_t> data;
     PatchTokensStreamReader(ArrayRef<const uint8_t> data) : data(data) {}
@@ -499,6 +502,10 @@ inline bool decodePatchList(PatchTokensStreamReader patchListStream, OutT &out)
     return decodeSuccess;
 }
 
+inline size_t getKernelInfoBlobSize(const SKernelBinaryHeaderCommon &header) {
+    return sizeof(SKernelBinaryHeaderCommon) + header.KernelNameSize + header.KernelHeapSize + header.GeneralStateHeapSize + header.DynamicStateHeapSize + header.SurfaceStateHeapSize + header.PatchListSize;
+}
+
 bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelFromPatchtokens &out) {
     PatchTokensStreamReader stream{kernelBlob};
     auto decodePos = stream.data.begin();
@@ -510,7 +517,7 @@ bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelF
 
     out.header = reinterpret_cast<const SKernelBinaryHeaderCommon *>(decodePos);
 
-    auto kernelInfoBlobSize = sizeof(SKernelBinaryHeaderCommon) + out.header->KernelNameSize + out.header->KernelHeapSize + out.header->GeneralStateHeapSize + out.header->DynamicStateHeapSize + out.header->SurfaceStateHeapSize + out.header->PatchListSize;
+    auto kernelInfoBlobSize = getKernelInfoBlobSize(*out.header);
 
     if (stream.notEnoughDataLeft(decodePos, kernelInfoBlobSize)) {
         out.decodeStatus = DecodeError::InvalidBinary;
@@ -572,18 +579,39 @@ inline bool decodeProgramHeader(ProgramFromPatchtokens &decodedProgram) {
 
 inline bool decodeKernels(ProgramFromPatchtokens &decodedProgram) {
     auto numKernels = decodedProgram.header->NumberOfKernels;
-    decodedProgram.kernels.reserve(decodedProgram.header->NumberOfKernels);
     const uint8_t *decodePos = decodedProgram.blobs.kernelsInfo.begin();
-    bool decodeSuccess = true;
     PatchTokensStreamReader stream{decodedProgram.blobs.kernelsInfo};
-    for (uint32_t i = 0; (i < numKernels) && decodeSuccess; i++) {
-        decodedProgram.kernels.resize(decodedProgram.kernels.size() + 1);
-        auto &currKernelInfo = *decodedProgram.kernels.rbegin();
+
+    // kernel boundaries depend only on kernel headers, so find them upfront and decode kernels independently
+    std::vector<ArrayRef<const uint8_t>> kernelBlobs;
+    kernelBlobs.reserve(std::min<size_t>(numKernels, 1U + decodedProgram.blobs.kernelsInfo.size() / sizeof(SKernelBinaryHeaderCommon)));
+    for (uint32_t i = 0; i < numKernels; i++) {
         auto kernelDataLeft = ArrayRef<const uint8_t>(decodePos, stream.getDataSizeLeft(decodePos));
-        decodeSuccess = decodeKernelFromPatchtokensBlob(kernelDataLeft, currKernelInfo);
-        decodePos = ptrOffset(decodePos, currKernelInfo.blobs.kernelInfo.size());
+        size_t kernelInfoBlobSize = 0U;
+        if (stream.enoughDataLeft<SKernelBinaryHeaderCommon>(decodePos)) {
+            kernelInfoBlobSize = getKernelInfoBlobSize(*reinterpret_cast<const SKernelBinaryHeaderCommon *>(decodePos));
+        }
+        if ((kernelInfoBlobSize == 0U) || stream.notEnoughDataLeft(decodePos, kernelInfoBlobSize)) {
+            kernelBlobs.push_back(kernelDataLeft); // decoding this blob reports the error
+            break;
+        }
+        kernelBlobs.push_back(ArrayRef<const uint8_t>(decodePos, kernelInfoBlobSize));
+        decodePos = ptrOffset(decodePos, kernelInfoBlobSize);
     }
-    return decodeSuccess;
+
+    decodedProgram.kernels.resize(kernelBlobs.size());
+    auto workersCount = (kernelBlobs.size() >= minKernelsCountForParallelDecode) ? getDefaultWorkersCount() : 1U;
+    parallelFor(kernelBlobs.size(), workersCount, [&](size_t kernelId) {
+        decodeKernelFromPatchtokensBlob(kernelBlobs[kernelId], decodedProgram.kernels[kernelId]);
+    });
+
+    for (size_t i = 0; i < decodedProgram.kernels.size(); i++) {
+        if (decodedProgram.kernels[i].decodeStatus != DecodeError::Success) {
+            decodedProgram.kernels.resize(i + 1);
+            return false;
+        }
+    }
+    return true;
 }
 
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out) {
@@ -192,6 +192,9 @@ struct KernelArgAttributesFromPatchtokens {
     ArrayRef<const char> typeQualifiers;
 };
 
+// programs with at least this many kernels get their kernels decoded on multiple threads
+extern size_t minKernelsCountForParallelDecode;
+
 bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelFromPatchtokens &out);
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out);
 uint32_t calcKernelChecksum(const ArrayRef<const uint8_t> kernelBlob);
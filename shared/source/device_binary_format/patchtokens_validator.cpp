@@ -9,12 +9,14 @@
 
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_arg_info.h"
 
 #include "igfxfmid.h"
 
 #include <string>
+#include <vector>
 
 namespace NEO {
 
@@ -22,6 +24,65 @@ namespace PatchTokenBinary {
 
 bool allowUnhandledTokens = true;
 
+DecodeError validateKernel(const KernelFromPatchtokens &decodedKernel, std::string &outErrReason, std::string &outWarnings) {
+    if (decodedKernel.decodeStatus != DecodeError::Success) {
+        outErrReason = "KernelFromPatchtokens wasn't successfully decoded";
+        return DecodeError::UnhandledBinary;
+    }
+
+    UNRECOVERABLE_IF(nullptr == decodedKernel.header);
+    if (hasInvalidChecksum(decodedKernel)) {
+        outErrReason = "KernelFromPatchtokens has invalid checksum";
+        return DecodeError::UnhandledBinary;
+    }
+
+    if (nullptr == decodedKernel.tokens.executionEnvironment) {
+        outErrReason = "Missing execution environment";
+        return DecodeError::UnhandledBinary;
+    } else {
+        switch (decodedKernel.tokens.executionEnvironment->LargestCompiledSIMDSize) {
+        case 1:
+            break;
+        case 8:
+            break;
+        case 16:
+            break;
+        case 32:
+            break;
+        default:
+            outErrReason = "Invalid LargestCompiledSIMDSize";
+            return DecodeError::UnhandledBinary;
+        }
+    }
+
+    for (auto &kernelArg : decodedKernel.tokens.kernelArgs) {
+        if (kernelArg.argInfo == nullptr) {
+            continue;
+        }
+        auto argInfoInlineData = getInlineData(kernelArg.argInfo);
+        auto accessQualifier = KernelArgMetadata::parseAccessQualifier(parseLimitedString(argInfoInlineData.accessQualifier.begin(), argInfoInlineData.accessQualifier.size()));
+        if (KernelArgMetadata::AccessUnknown == accessQualifier) {
+            outErrReason = "Unhandled access qualifier";
+            return DecodeError::UnhandledBinary;
+        }
+        auto addressQualifier = KernelArgMetadata::parseAddressSpace(parseLimitedString(argInfoInlineData.addressQualifier.begin(), argInfoInlineData.addressQualifier.size()));
+        if (KernelArgMetadata::AddrUnknown == addressQualifier) {
+            outErrReason = "Unhandled address qualifier";
+            return DecodeError::UnhandledBinary;
+        }
+    }
+
+    for (const auto &unhandledToken : decodedKernel.unhandledTokens) {
+        if (allowUnhandledTokens) {
+            outWarnings = "Unknown kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
+        } else {
+            outErrReason = "Unhandled required kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
+            return DecodeError::UnhandledBinary;
+        }
+    }
+    return DecodeError::Success;
+}
+
 DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
                      std::string &outErrReason, std::string &outWarnings) {
     if (decodedProgram.decodeStatus != DecodeError::Success) {
@@ -85,61 +146,26 @@ DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
         return DecodeError::UnhandledBinary;
     }
 
-    for (const auto &decodedKernel : decodedProgram.kernels) {
-        if (decodedKernel.decodeStatus != DecodeError::Success) {
-            outErrReason = "KernelFromPatchtokens wasn't successfully decoded";
-            return DecodeError::UnhandledBinary;
-        }
-
-        UNRECOVERABLE_IF(nullptr == decodedKernel.header);
-        if (hasInvalidChecksum(decodedKernel)) {
-            outErrReason = "KernelFromPatchtokens has invalid checksum";
-            return DecodeError::UnhandledBinary;
+    struct KernelValidationResult {
+        DecodeError status = DecodeError::Undefined;
+        std::string errReason;
+        std::string warnings;
+    };
+    std::vector<KernelValidationResult> kernelsValidationResults(decodedProgram.kernels.size());
+    auto workersCount = (decodedProgram.kernels.size() >= minKernelsCountForParallelDecode) ? getDefaultWorkersCount() : 1U;
+    parallelFor(decodedProgram.kernels.size(), workersCount, [&](size_t kernelId) {
+        auto &result = kernelsValidationResults[kernelId];
+        result.status = validateKernel(decodedProgram.kernels[kernelId], result.errReason, result.warnings);
+    });
+
+    // report in kernels order, as if kernels were validated one by one
+    for (auto &result : kernelsValidationResults) {
+        if (false == result.warnings.empty()) {
+            outWarnings = std::move(result.warnings);
         }
-
-        if (nullptr == decodedKernel.tokens.executionEnvironment) {
-            outErrReason = "Missing execution environment";
-            return DecodeError::UnhandledBinary;
-        } else {
-            switch (decodedKernel.tokens.executionEnvironment->LargestCompiledSIMDSize) {
-            case 1:
-                break;
-            case 8:
-                break;
-            case 16:
-                break;
-            case 32:
-                break;
-            default:
-                outErrReason = "Invalid LargestCompiledSIMDSize";
-                return DecodeError::UnhandledBinary;
-            }
-        }
-
-        for (auto &kernelArg : decodedKernel.tokens.kernelArgs) {
-            if (kernelArg.argInfo == nullptr) {
-                continue;
-            }
-            auto argInfoInlineData = getInlineData(kernelArg.argInfo);
-            auto accessQualifier = KernelArgMetadata::parseAccessQualifier(parseLimitedString(argInfoInlineData.accessQualifier.begin(), argInfoInlineData.accessQualifier.size()));
-            if (KernelArgMetadata::AccessUnknown == accessQualifier) {
-                outErrReason = "Unhandled access qualifier";
-                return DecodeError::UnhandledBinary;
-            }
-            auto addressQualifier = KernelArgMetadata::parseAddressSpace(parseLimitedString(argInfoInlineData.addressQualifier.begin(), argInfoInlineData.addressQualifier.size()));
-            if (KernelArgMetadata::AddrUnknown == addressQualifier) {
-                outErrReason = "Unhandled address qualifier";
-                return DecodeError::UnhandledBinary;
-            }
-        }
-
-        for (const auto &unhandledToken : decodedKernel.unhandledTokens) {
-            if (allowUnhandledTokens) {
-                outWarnings = "Unknown kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
-            } else {
-                outErrReason = "Unhandled required kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
-                return DecodeError::UnhandledBinary;
-            }
+        if (result.status != DecodeError::Success) {
+            outErrReason = std::move(result.errReason);
+            return result.status;
         }
     }
 
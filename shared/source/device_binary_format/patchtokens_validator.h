@@ -16,8 +16,12 @@ namespace NEO {
 namespace PatchTokenBinary {
 extern bool allowUnhandledTokens;
 
+struct KernelFromPatchtokens;
 struct ProgramFromPatchtokens;
 
+DecodeError validateKernel(const KernelFromPatchtokens &decodedKernel,
+                           std::string &outErrReason, std::string &outWarnings);
+
 DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
                      std::string &outErrReason, std::string &outWarnings);
 
@@ -8,6 +8,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debugger/debugger.h"
@@ -26,6 +27,7 @@ ExecutionEnvironment::~ExecutionEnvironment() {
     debugger.reset();
     for (auto &rootDeviceEnvironment : rootDeviceEnvironments) {
         rootDeviceEnvironment->builtins.reset();
+        rootDeviceEnvironment->scratchSpacePool.reset();
     }
     if (memoryManager) {
         memoryManager->commonCleanup();
@@ -8,6 +8,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/execution_environment/execution_environment.h"
@@ -65,4 +66,11 @@ BuiltIns *RootDeviceEnvironment::getBuiltIns() {
     }
     return this->builtins.get();
 }
+
+ScratchSpacePool *RootDeviceEnvironment::getScratchSpacePool(uint32_t rootDeviceIndex) {
+    std::call_once(this->scratchSpacePoolCreated, [&]() {
+        this->scratchSpacePool = std::make_unique<ScratchSpacePool>(rootDeviceIndex, *executionEnvironment.memoryManager);
+    });
+    return this->scratchSpacePool.get();
+}
 } // namespace NEO
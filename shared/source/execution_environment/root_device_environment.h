@@ -24,6 +24,7 @@ class ExecutionEnvironment;
 class GmmPageTableMngr;
 class MemoryOperationsHandler;
 class OSInterface;
+class ScratchSpacePool;
 struct HardwareInfo;
 class HwDeviceId;
 
@@ -40,6 +41,7 @@ struct RootDeviceEnvironment {
     GmmClientContext *getGmmClientContext() const;
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface();
     BuiltIns *getBuiltIns();
+    ScratchSpacePool *getScratchSpacePool(uint32_t rootDeviceIndex);
 
     std::unique_ptr<GmmHelper> gmmHelper;
     std::unique_ptr<OSInterface> osInterface;
@@ -49,9 +51,11 @@ struct RootDeviceEnvironment {
 
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<CompilerInterface> compilerInterface;
+    std::unique_ptr<ScratchSpacePool> scratchSpacePool;
     ExecutionEnvironment &executionEnvironment;
 
   private:
     std::mutex mtx;
+    std::once_flag scratchSpacePoolCreated;
 };
 } // namespace NEO
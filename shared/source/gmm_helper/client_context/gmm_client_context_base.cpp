@@ -41,6 +41,9 @@ GmmClientContextBase::GmmClientContextBase(OSInterface *osInterface, HardwareInf
     clientContext = outArgs.pGmmClientContext;
 }
 GmmClientContextBase::~GmmClientContextBase() {
+    // cached resources have to be destroyed before GmmLib client context
+    imageResourceCache.clear();
+
     GMM_INIT_OUT_ARGS outArgs;
     outArgs.pGmmClientContext = clientContext;
 
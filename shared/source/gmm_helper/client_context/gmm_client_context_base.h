@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/gmm_helper/gmm_lib.h"
+#include "shared/source/gmm_helper/image_resource_cache.h"
 
 #include <memory>
 
@@ -36,9 +37,14 @@ class GmmClientContextBase {
     MOCKABLE_VIRTUAL uint8_t getSurfaceStateCompressionFormat(GMM_RESOURCE_FORMAT format);
     MOCKABLE_VIRTUAL uint8_t getMediaSurfaceStateCompressionFormat(GMM_RESOURCE_FORMAT format);
 
+    ImageResourceCache &getImageResourceCache() {
+        return imageResourceCache;
+    }
+
   protected:
     HardwareInfo *hardwareInfo = nullptr;
     GMM_CLIENT_CONTEXT *clientContext;
+    ImageResourceCache imageResourceCache;
     GmmClientContextBase(OSInterface *osInterface, HardwareInfo *hwInfo);
 };
 } // namespace NEO
@@ -9,6 +9,7 @@
 
 #include "shared/source/gmm_helper/client_context/gmm_client_context.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/gmm_helper/image_resource_cache.h"
 #include "shared/source/gmm_helper/resource_info.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -59,12 +60,26 @@ Gmm::Gmm(GmmClientContext *clientContext, GMM_RESOURCE_INFO *inputGmm) : clientC
 
 Gmm::Gmm(GmmClientContext *clientContext, ImageInfo &inputOutputImgInfo, StorageInfo storageInfo) : clientContext(clientContext) {
     this->resourceParams = {};
+
+    auto useImageResourceCache = ImageResourceCache::isCachingEnabled();
+    ImageResourceCache::Key cacheKey = {};
+    if (useImageResourceCache) {
+        cacheKey = ImageResourceCache::createKey(inputOutputImgInfo, storageInfo.getMemoryBanks());
+        if (clientContext->getImageResourceCache().restore(cacheKey, clientContext, *this, inputOutputImgInfo)) {
+            return;
+        }
+    }
+
     setupImageResourceParams(inputOutputImgInfo);
     applyMemoryFlags(!inputOutputImgInfo.useLocalMemory, storageInfo);
     this->gmmResourceInfo.reset(GmmResourceInfo::create(clientContext, &this->resourceParams));
     UNRECOVERABLE_IF(this->gmmResourceInfo == nullptr);
 
     queryImageParams(inputOutputImgInfo);
+
+    if (useImageResourceCache) {
+        clientContext->getImageResourceCache().store(cacheKey, clientContext, *this, inputOutputImgInfo);
+    }
 }
 
 void Gmm::setupImageResourceParams(ImageInfo &imgInfo) {
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/gmm_helper/image_resource_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/gmm_helper/gmm.h"
+#include "shared/source/gmm_helper/resource_info.h"
+
+#include <tuple>
+
+namespace NEO {
+
+bool ImageResourceCache::Key::operator<(const Key &other) const {
+    auto tieKey = [](const Key &key) {
+        return std::tie(key.imgDesc.imageType, key.imgDesc.imageWidth, key.imgDesc.imageHeight, key.imgDesc.imageDepth,
+                        key.imgDesc.imageArraySize, key.imgDesc.imageRowPitch, key.imgDesc.imageSlicePitch,
+                        key.imgDesc.numMipLevels, key.imgDesc.numSamples, key.imgDesc.fromParent,
+                        key.format, key.plane, key.baseMipLevel, key.mipCount,
+                        key.linearStorage, key.preferRenderCompression, key.useLocalMemory, key.memoryBanks);
+    };
+    return tieKey(*this) < tieKey(other);
+}
+
+ImageResourceCache::ImageResourceCache() {
+    if (DebugManager.flags.ImageResourceCacheMaxEntries.get() != -1) {
+        maxEntries = static_cast<size_t>(DebugManager.flags.ImageResourceCacheMaxEntries.get());
+    }
+}
+
+ImageResourceCache::~ImageResourceCache() = default;
+
+bool ImageResourceCache::isCachingEnabled() {
+    return DebugManager.flags.EnableImageResourceCache.get() == 1;
+}
+
+ImageResourceCache::Key ImageResourceCache::createKey(const ImageInfo &imgInfo, uint32_t memoryBanks) {
+    Key key = {};
+    key.imgDesc = imgInfo.imgDesc;
+    key.format = imgInfo.surfaceFormat->GMMSurfaceFormat;
+    key.plane = imgInfo.plane;
+    key.baseMipLevel = imgInfo.baseMipLevel;
+    key.mipCount = imgInfo.mipCount;
+    key.linearStorage = imgInfo.linearStorage;
+    key.preferRenderCompression = imgInfo.preferRenderCompression;
+    key.useLocalMemory = imgInfo.useLocalMemory;
+    key.memoryBanks = memoryBanks;
+    return key;
+}
+
+bool ImageResourceCache::restore(const Key &key, GmmClientContext *clientContext, Gmm &gmm, ImageInfo &imgInfo) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entriesMap.find(key);
+    if (it == entriesMap.end()) {
+        missesCount++;
+        return false;
+    }
+    auto &entry = *it->second;
+    entries.splice(entries.begin(), entries, it->second);
+
+    gmm.resourceParams = entry.resourceParams;
+    gmm.gmmResourceInfo.reset(GmmResourceInfo::create(clientContext, entry.resourceInfo->peekHandle()));
+    gmm.isRenderCompressed = entry.isRenderCompressed;
+    gmm.useSystemMemoryPool = entry.useSystemMemoryPool;
+
+    // only parameters computed by Gmm::queryImageParams are restored
+    imgInfo.size = entry.imgInfo.size;
+    imgInfo.rowPitch = entry.imgInfo.rowPitch;
+    imgInfo.slicePitch = entry.imgInfo.slicePitch;
+    imgInfo.qPitch = entry.imgInfo.qPitch;
+    if (imgInfo.plane != GMM_NO_PLANE) {
+        imgInfo.offset = entry.imgInfo.offset;
+        imgInfo.xOffset = entry.imgInfo.xOffset;
+        imgInfo.yOffset = entry.imgInfo.yOffset;
+    }
+    if (key.format == GMM_RESOURCE_FORMAT::GMM_FORMAT_NV12 || key.format == GMM_RESOURCE_FORMAT::GMM_FORMAT_P010) {
+        imgInfo.yOffsetForUVPlane = entry.imgInfo.yOffsetForUVPlane;
+    }
+    hitsCount++;
+    return true;
+}
+
+void ImageResourceCache::store(const Key &key, GmmClientContext *clientContext, Gmm &gmm, const ImageInfo &imgInfo) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (maxEntries == 0u || entriesMap.find(key) != entriesMap.end()) {
+        return;
+    }
+    if (entries.size() >= maxEntries) {
+        entriesMap.erase(entries.back().key);
+        entries.pop_back();
+    }
+
+    Entry entry;
+    entry.key = key;
+    entry.resourceParams = gmm.resourceParams;
+    entry.resourceInfo.reset(GmmResourceInfo::create(clientContext, gmm.gmmResourceInfo->peekHandle()));
+    entry.imgInfo = imgInfo;
+    entry.imgInfo.surfaceFormat = nullptr;
+    entry.isRenderCompressed = gmm.isRenderCompressed;
+    entry.useSystemMemoryPool = gmm.useSystemMemoryPool;
+    entries.push_front(std::move(entry));
+    entriesMap[key] = entries.begin();
+}
+
+void ImageResourceCache::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    entriesMap.clear();
+    entries.clear();
+}
+} // namespace NEO
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/gmm_helper/gmm_lib.h"
+#include "shared/source/helpers/surface_format_info.h"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class Gmm;
+class GmmClientContext;
+class GmmResourceInfo;
+
+// Keeps image resource parameters computed by GmmLib, so that images with identical
+// format and descriptor don't need to query GmmLib again.
+// Cache is owned by GmmClientContext, so hwInfo is implicitly part of the key.
+class ImageResourceCache {
+  public:
+    static constexpr size_t defaultMaxEntries = 256u;
+
+    struct Key {
+        ImageDescriptor imgDesc;
+        GMM_RESOURCE_FORMAT format;
+        GMM_YUV_PLANE_ENUM plane;
+        uint32_t baseMipLevel;
+        uint32_t mipCount;
+        bool linearStorage;
+        bool preferRenderCompression;
+        bool useLocalMemory;
+        uint32_t memoryBanks;
+
+        bool operator<(const Key &other) const;
+    };
+
+    ImageResourceCache();
+    ~ImageResourceCache();
+
+    static bool isCachingEnabled();
+    static Key createKey(const ImageInfo &imgInfo, uint32_t memoryBanks);
+
+    bool restore(const Key &key, GmmClientContext *clientContext, Gmm &gmm, ImageInfo &imgInfo);
+    void store(const Key &key, GmmClientContext *clientContext, Gmm &gmm, const ImageInfo &imgInfo);
+    void clear();
+
+    size_t getEntriesCount() const { return entries.size(); }
+    uint64_t getHitsCount() const { return hitsCount; }
+    uint64_t getMissesCount() const { return missesCount; }
+
+  protected:
+    struct Entry {
+        Key key;
+        GMM_RESCREATE_PARAMS resourceParams;
+        std::unique_ptr<GmmResourceInfo> resourceInfo;
+        ImageInfo imgInfo;
+        bool isRenderCompressed;
+        bool useSystemMemoryPool;
+    };
+    using EntriesList = std::list<Entry>;
+
+    size_t maxEntries = defaultMaxEntries;
+    // ordered from the most recently used
+    EntriesList entries;
+    std::map<Key, EntriesList::iterator> entriesMap;
+    uint64_t hitsCount = 0;
+    uint64_t missesCount = 0;
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -9,8 +9,11 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/tag_allocator.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 void TimestampPacketContainer::add(Node *timestampPacketNode) {
@@ -64,3 +67,47 @@ bool TimestampPacketContainer::isCompleted() const {
     }
     return true;
 }
+
+std::atomic<uint64_t> TimestampPacketHelper::elidedDependenciesCount{0u};
+
+size_t TimestampPacketHelper::getNodesToWait(const CsrDependencies &csrDependencies, NodesToWait &nodesToWait) {
+    size_t dependenciesCount = 0;
+    bool pruningEnabled = DebugManager.flags.EnableTimestampPacketDependencyPruning.get() != 0;
+
+    for (auto timestampPacketContainer : csrDependencies) {
+        for (auto node : timestampPacketContainer->peekNodes()) {
+            dependenciesCount++;
+            if (!pruningEnabled) {
+                nodesToWait.push_back(node);
+                continue;
+            }
+            if (node->tagForCpuAccess->isEndWritten() ||
+                std::find(nodesToWait.begin(), nodesToWait.end(), node) != nodesToWait.end()) {
+                continue;
+            }
+            nodesToWait.push_back(node);
+        }
+    }
+
+    if (pruningEnabled) {
+        auto isImpliedByLaterNode = [&nodesToWait](const TimestampPacketContainer::Node *node) {
+            if (node->getTimelineId() == 0u) {
+                return false;
+            }
+            return std::any_of(nodesToWait.begin(), nodesToWait.end(), [node](const TimestampPacketContainer::Node *otherNode) {
+                return otherNode->getTimelineId() == node->getTimelineId() &&
+                       otherNode->getTimelineSequence() > node->getTimelineSequence();
+            });
+        };
+
+        NodesToWait latestNodes;
+        for (auto node : nodesToWait) {
+            if (!isImpliedByLaterNode(node)) {
+                latestNodes.push_back(node);
+            }
+        }
+        nodesToWait = std::move(latestNodes);
+    }
+
+    return dependenciesCount - nodesToWait.size();
+}
@@ -44,12 +44,17 @@ struct TimestampPacketStorage {
     }
 
     bool isCompleted() const {
+        return isEndWritten() && implicitDependenciesCount.load() == 0;
+    }
+
+    // Unlike isCompleted, doesn't change back when new implicit dependency is programmed
+    bool isEndWritten() const {
         for (uint32_t i = 0; i < packetsUsed; i++) {
             if ((packets[i].contextEnd & 1) || (packets[i].globalEnd & 1)) {
                 return false;
             }
         }
-        return implicitDependenciesCount.load() == 0;
+        return true;
     }
 
     void initialize() {
@@ -103,6 +108,13 @@ struct TimestampPacketDependencies : public NonCopyableClass {
 };
 
 struct TimestampPacketHelper {
+    using NodesToWait = StackVec<TagNode<TimestampPacketStorage> *, 32>;
+
+    // Collects nodes from csrDependencies that need a semaphore. Nodes already completed, duplicated
+    // or followed by a later node from the same timeline are skipped. Returns number of skipped nodes.
+    static size_t getNodesToWait(const CsrDependencies &csrDependencies, NodesToWait &nodesToWait);
+    static uint64_t getElidedDependenciesCount() { return elidedDependenciesCount.load(std::memory_order_relaxed); }
+
     template <typename GfxFamily>
     static void programSemaphoreWithImplicitDependency(LinearStream &cmdStream, TagNode<TimestampPacketStorage> &timestampPacketNode) {
         using MI_ATOMIC = typename GfxFamily::MI_ATOMIC;
@@ -128,10 +140,13 @@ struct TimestampPacketHelper {
 
     template <typename GfxFamily>
     static void programCsrDependencies(LinearStream &cmdStream, const CsrDependencies &csrDependencies) {
-        for (auto timestampPacketContainer : csrDependencies) {
-            for (auto &node : timestampPacketContainer->peekNodes()) {
-                TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(cmdStream, *node);
-            }
+        NodesToWait nodesToWait;
+        auto elidedCount = getNodesToWait(csrDependencies, nodesToWait);
+        for (auto node : nodesToWait) {
+            TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(cmdStream, *node);
+        }
+        if (elidedCount > 0) {
+            elidedDependenciesCount.fetch_add(elidedCount, std::memory_order_relaxed);
         }
     }
 
@@ -167,14 +182,17 @@ struct TimestampPacketHelper {
     template <typename GfxFamily>
     static size_t getRequiredCmdStreamSize(const CsrDependencies &csrDependencies) {
         size_t totalCommandsSize = 0;
-        for (auto timestampPacketContainer : csrDependencies) {
-            for (auto &node : timestampPacketContainer->peekNodes()) {
-                totalCommandsSize += getRequiredCmdStreamSizeForNodeDependency<GfxFamily>(*node);
-            }
+        NodesToWait nodesToWait;
+        getNodesToWait(csrDependencies, nodesToWait);
+        for (auto node : nodesToWait) {
+            totalCommandsSize += getRequiredCmdStreamSizeForNodeDependency<GfxFamily>(*node);
         }
 
         return totalCommandsSize;
     }
+
+  protected:
+    static std::atomic<uint64_t> elidedDependenciesCount;
 };
 
 } // namespace NEO
@@ -61,6 +61,7 @@ std::string GraphicsAllocation::getAllocationInfoString() const {
 uint32_t GraphicsAllocation::getUsedPageSize() const {
     switch (this->memoryPool) {
     case MemoryPool::System64KBPages:
+    case MemoryPool::System2MBPages:
     case MemoryPool::System64KBPagesWith32BitGpuAddressing:
     case MemoryPool::LocalMemory:
         return MemoryConstants::pageSize64k;
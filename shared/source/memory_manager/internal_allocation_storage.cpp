@@ -11,6 +11,7 @@
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/runtime_counters.h"
 
 namespace NEO {
 InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver) : commandStreamReceiver(commandStreamReceiver){};
@@ -63,6 +64,9 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType) {
     auto allocation = allocationsForReuse.detachAllocation(requiredSize, commandStreamReceiver, allocationType);
+    if (allocation) {
+        RuntimeCounters::increment(RuntimeCounter::reusableAllocationHits);
+    }
     return allocation;
 }
 
@@ -27,6 +27,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/compiler_support.h"
+#include "shared/source/utilities/runtime_counters.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include <algorithm>
@@ -56,6 +57,17 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
     if (anyLocalMemorySupported) {
         pageFaultManager = PageFaultManager::create();
     }
+
+    // engines may be created lazily while others are in use, avoid reallocation of registered engines
+    registeredEngines.reserve(maxOsContextCount);
+
+    if (DebugManager.flags.EnableHugePageAllocations.get() == 1) {
+        hugePageAllocationsEnabled = true;
+        osMemory = OSMemory::create();
+        if (DebugManager.flags.HugePageAllocationThresholdInKb.get() != -1) {
+            hugePageAllocationThreshold = static_cast<size_t>(DebugManager.flags.HugePageAllocationThresholdInKb.get()) * MemoryConstants::kiloByte;
+        }
+    }
 }
 
 MemoryManager::~MemoryManager() {
@@ -97,6 +109,16 @@ void *MemoryManager::allocateSystemMemory(size_t size, size_t alignment) {
     return ptr;
 }
 
+void *MemoryManager::allocateHugePageSystemMemory(size_t size, size_t alignment) {
+    UNRECOVERABLE_IF(!isAligned<MemoryConstants::pageSize2Mb>(size));
+    // 2MB aligned and sized memory lets kernel back it with transparent huge pages
+    auto ptr = allocateSystemMemory(size, std::max(alignment, MemoryConstants::pageSize2Mb));
+    if (ptr && osMemory) {
+        osMemory->adviseHugePages(ptr, size);
+    }
+    return ptr;
+}
+
 GraphicsAllocation *MemoryManager::allocateGraphicsMemoryWithHostPtr(const AllocationData &allocationData) {
     if (deferredDeleter) {
         deferredDeleter->drain(true);
@@ -163,7 +185,7 @@ void MemoryManager::checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocatio
             multiContextResourceDestructor->drain(false);
             return;
         }
-        for (auto &engine : getRegisteredEngines()) {
+        for (auto &engine : getRegisteredEnginesSnapshot()) {
             auto osContextId = engine.osContext->getContextId();
             auto allocationTaskCount = gfxAllocation->getTaskCount(osContextId);
             if (gfxAllocation->isUsedByOsContext(osContextId) &&
@@ -202,6 +224,7 @@ bool MemoryManager::isMemoryBudgetExhausted() const {
 OsContext *MemoryManager::createAndRegisterOsContext(CommandStreamReceiver *commandStreamReceiver, aub_stream::EngineType engineType,
                                                      DeviceBitfield deviceBitfield, PreemptionMode preemptionMode,
                                                      bool lowPriority, bool internalEngine, bool rootDevice) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     auto contextId = ++latestContextId;
     auto osContext = OsContext::create(peekExecutionEnvironment().rootDeviceEnvironments[commandStreamReceiver->getRootDeviceIndex()]->osInterface.get(),
                                        contextId, deviceBitfield, engineType, preemptionMode,
@@ -341,6 +364,9 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(const A
     if (!allocation && status == AllocationStatus::RetryInNonDevicePool) {
         allocation = allocateGraphicsMemory(allocationData);
     }
+    if (allocation) {
+        RuntimeCounters::incrementAllocations(static_cast<uint32_t>(allocation->getAllocationType()), static_cast<uint32_t>(allocation->getMemoryPool()));
+    }
     FileLoggerInstance().logAllocation(allocation);
     return allocation;
 }
@@ -402,7 +428,31 @@ EngineControlContainer &MemoryManager::getRegisteredEngines() {
     return registeredEngines;
 }
 
+EngineControlSnapshot::EngineControlSnapshot(const EngineControlContainer &registeredEngines, std::mutex &registeredEnginesMutex) {
+    if (DebugManager.flags.EnableLazyEngineCreation.get() != 1) {
+        engines = registeredEngines.data();
+        enginesCount = registeredEngines.size();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
+    for (auto &engine : registeredEngines) {
+        copiedEngines.push_back(engine);
+    }
+    enginesCount = copiedEngines.size();
+    isCopy = true;
+}
+
+EngineControlSnapshot MemoryManager::getRegisteredEnginesSnapshot() const {
+    return EngineControlSnapshot(registeredEngines, registeredEnginesMutex);
+}
+
+uint32_t MemoryManager::getRegisteredEnginesCount() const {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
+    return static_cast<uint32_t>(registeredEngines.size());
+}
+
 EngineControl *MemoryManager::getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     EngineControl *engineCtrl = nullptr;
     for (auto &engine : registeredEngines) {
         if (engine.commandStreamReceiver == commandStreamReceiver) {
@@ -414,6 +464,7 @@ EngineControl *MemoryManager::getRegisteredEngineForCsr(CommandStreamReceiver *c
 }
 
 void MemoryManager::unregisterEngineForCsr(CommandStreamReceiver *commandStreamReceiver) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     auto numRegisteredEngines = registeredEngines.size();
     for (auto i = 0u; i < numRegisteredEngines; i++) {
         if (registeredEngines[i].commandStreamReceiver == commandStreamReceiver) {
@@ -477,7 +528,7 @@ bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocatio
 }
 
 void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation) {
-    for (auto &engine : getRegisteredEngines()) {
+    for (auto &engine : getRegisteredEnginesSnapshot()) {
         auto osContextId = engine.osContext->getContextId();
         auto allocationTaskCount = graphicsAllocation.getTaskCount(osContextId);
         if (graphicsAllocation.isUsedByOsContext(osContextId) &&
@@ -488,7 +539,7 @@ void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocat
 }
 
 void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion) {
-    for (auto &engine : getRegisteredEngines()) {
+    for (auto &engine : getRegisteredEnginesSnapshot()) {
         auto csr = engine.commandStreamReceiver;
         if (waitForCompletion) {
             csr->waitForCompletionWithTimeout(false, 0, csr->peekLatestSentTaskCount());
@@ -17,6 +17,7 @@
 #include "shared/source/memory_manager/host_ptr_defines.h"
 #include "shared/source/memory_manager/local_memory_usage.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "engine_node.h"
 
@@ -43,6 +44,24 @@ struct AlignedMallocRestrictions {
 
 constexpr size_t paddingBufferSize = 2 * MemoryConstants::megaByte;
 
+// Registered engines are copied under lock only when they may be created lazily from other threads,
+// otherwise engines registered during device creation are referenced without locking.
+class EngineControlSnapshot {
+  public:
+    EngineControlSnapshot(const EngineControlContainer &registeredEngines, std::mutex &registeredEnginesMutex);
+
+    const EngineControl *begin() const { return isCopy ? copiedEngines.begin() : engines; }
+    const EngineControl *end() const { return begin() + enginesCount; }
+    size_t size() const { return enginesCount; }
+    const EngineControl &operator[](size_t index) const { return begin()[index]; }
+
+  protected:
+    StackVec<EngineControl, 32> copiedEngines;
+    const EngineControl *engines = nullptr;
+    size_t enginesCount = 0;
+    bool isCopy = false;
+};
+
 class MemoryManager {
   public:
     enum AllocationStatus {
@@ -57,6 +76,11 @@ class MemoryManager {
     virtual ~MemoryManager();
     MOCKABLE_VIRTUAL void *allocateSystemMemory(size_t size, size_t alignment);
 
+    bool isHugePageAllocationPreferred(size_t size) const {
+        return hugePageAllocationsEnabled && size >= hugePageAllocationThreshold;
+    }
+    void *allocateHugePageSystemMemory(size_t size, size_t alignment);
+
     virtual void addAllocationToHostPtrManager(GraphicsAllocation *memory) = 0;
     virtual void removeAllocationFromHostPtrManager(GraphicsAllocation *memory) = 0;
 
@@ -149,8 +173,10 @@ class MemoryManager {
     OsContext *createAndRegisterOsContext(CommandStreamReceiver *commandStreamReceiver, aub_stream::EngineType engineType,
                                           DeviceBitfield deviceBitfield, PreemptionMode preemptionMode,
                                           bool lowPriority, bool internalEngine, bool rootDevice);
-    uint32_t getRegisteredEnginesCount() const { return static_cast<uint32_t>(registeredEngines.size()); }
+    uint32_t getRegisteredEnginesCount() const;
+    // container is not guarded, it may be used only when no engine is registered concurrently
     EngineControlContainer &getRegisteredEngines();
+    EngineControlSnapshot getRegisteredEnginesSnapshot() const;
     EngineControl *getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
     void unregisterEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
     HostPtrManager *getHostPtrManager() const { return hostPtrManager.get(); }
@@ -245,6 +271,7 @@ class MemoryManager {
     bool supportsMultiStorageResources = true;
     ExecutionEnvironment &executionEnvironment;
     EngineControlContainer registeredEngines;
+    mutable std::mutex registeredEnginesMutex;
     std::unique_ptr<HostPtrManager> hostPtrManager;
     uint32_t latestContextId = std::numeric_limits<uint32_t>::max();
     uint32_t defaultEngineIndex = 0;
@@ -253,6 +280,9 @@ class MemoryManager {
     std::vector<std::unique_ptr<LocalMemoryUsageBankSelector>> localMemoryUsageBankSelector;
     void *reservedMemory = nullptr;
     std::unique_ptr<PageFaultManager> pageFaultManager;
+    bool hugePageAllocationsEnabled = false;
+    size_t hugePageAllocationThreshold = MemoryConstants::pageSize2Mb;
+    std::unique_ptr<OSMemory> osMemory;
 };
 
 std::unique_ptr<DeferredDeleter> createDeferredDeleter();
@@ -20,10 +20,12 @@ constexpr Type System4KBPagesWith32BitGpuAddressing{3};
 constexpr Type System64KBPagesWith32BitGpuAddressing{4};
 constexpr Type SystemCpuInaccessible{5};
 constexpr Type LocalMemory{6};
+constexpr Type System2MBPages{7};
 
 inline bool isSystemMemoryPool(Type pool) {
     return pool == System4KBPages ||
            pool == System64KBPages ||
+           pool == System2MBPages ||
            pool == System4KBPagesWith32BitGpuAddressing ||
            pool == System64KBPagesWith32BitGpuAddressing;
 }
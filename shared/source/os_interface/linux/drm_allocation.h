@@ -51,7 +51,11 @@ class DrmAllocation : public GraphicsAllocation {
 
     uint64_t peekInternalHandle(MemoryManager *memoryManager) override;
 
+    bool isUserptrCacheable() const { return userptrCacheable; }
+    void setUserptrCacheable(bool cacheable) { userptrCacheable = cacheable; }
+
   protected:
     BufferObjects bufferObjects{};
+    bool userptrCacheable = false;
 };
 } // namespace NEO
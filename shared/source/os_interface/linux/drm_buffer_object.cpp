@@ -12,7 +12,9 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_time_linux.h"
+#include "shared/source/utilities/runtime_counters.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "drm/i915_drm.h"
 
@@ -116,6 +118,8 @@ int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bo
     execbuf.flags = flags;
     execbuf.rsvd1 = drmContextId;
 
+    TraceRecorderScope traceRecorderScope(TraceCategory::system, "execbuffer2");
+    RuntimeCounters::increment(RuntimeCounter::execCalls);
     int ret = this->drm->ioctl(DRM_IOCTL_I915_GEM_EXECBUFFER2, &execbuf);
     if (ret == 0) {
         return 0;
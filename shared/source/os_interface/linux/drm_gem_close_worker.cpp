@@ -14,9 +14,9 @@
 
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
-#include <queue>
 #include <stdio.h>
 
 namespace NEO {
@@ -43,10 +43,30 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    bool wakeUpRequired = queue.empty() && gpuRangesQueue.empty();
     workCount++;
-    queue.push(bo);
+    queue.push_back(bo);
     lock.unlock();
-    condition.notify_one();
+    if (wakeUpRequired) {
+        condition.notify_one();
+    }
+}
+
+void DrmGemCloseWorker::push(BufferObject *const *bufferObjects, size_t bufferObjectsCount, const DeferredGpuRange &gpuRange) {
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    bool wakeUpRequired = queue.empty() && gpuRangesQueue.empty();
+    for (size_t i = 0; i < bufferObjectsCount; i++) {
+        if (bufferObjects[i]) {
+            workCount++;
+            queue.push_back(bufferObjects[i]);
+        }
+    }
+    workCount++;
+    gpuRangesQueue.push_back(gpuRange);
+    lock.unlock();
+    if (wakeUpRequired) {
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -67,39 +87,57 @@ inline void DrmGemCloseWorker::close(BufferObject *bo) {
     workCount--;
 }
 
+void DrmGemCloseWorker::processBatch(std::vector<BufferObject *> &bufferObjects, std::vector<DeferredGpuRange> &gpuRanges) {
+    for (auto bo : bufferObjects) {
+        close(bo);
+    }
+    bufferObjects.clear();
+
+    // ranges are released only after every buffer object of the batch is closed,
+    // so no range is handed out again while an old buffer object is still bound to it
+    for (auto &gpuRange : gpuRanges) {
+        memoryManager.releaseDeferredGpuRange(gpuRange);
+        workCount--;
+    }
+    gpuRanges.clear();
+}
+
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
+    std::vector<BufferObject *> localQueue;
+    std::vector<DeferredGpuRange> localGpuRanges;
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
 
     while (self->active) {
         lock.lock();
-        workItem = nullptr;
 
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+        while (self->queue.empty() && self->gpuRangesQueue.empty() && self->active) {
+            auto userptrCache = self->memoryManager.peekUserptrCache();
+            if (userptrCache == nullptr) {
+                self->condition.wait(lock);
+                continue;
+            }
+            // idle userptr cache entries are released also when process stops allocating and freeing memory
+            auto trimInterval = std::max(userptrCache->getIdleTimeout(), std::chrono::milliseconds(1));
+            if (std::cv_status::timeout == self->condition.wait_for(lock, trimInterval)) {
+                lock.unlock();
+                self->memoryManager.trimIdleUserptrCacheEntries();
+                lock.lock();
+            }
         }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
-        }
+        localQueue.swap(self->queue);
+        localGpuRanges.swap(self->gpuRangesQueue);
 
         lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
-        }
+        self->processBatch(localQueue, localGpuRanges);
     }
 
     lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
-    }
+    localQueue.swap(self->queue);
+    localGpuRanges.swap(self->gpuRangesQueue);
+    self->processBatch(localQueue, localGpuRanges);
 
     lock.unlock();
     self->workerDone.store(true);
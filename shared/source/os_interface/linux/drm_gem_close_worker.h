@@ -11,8 +11,8 @@
 #include <cstdint>
 #include <map>
 #include <mutex>
-#include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,6 +24,15 @@ enum class gemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+// GPU VA range (and CPU storage backing it) of a freed allocation.
+// It can be reused only after all buffer objects bound to it are closed.
+struct DeferredGpuRange {
+    void *address = nullptr;
+    size_t size = 0;
+    uint32_t rootDeviceIndex = 0;
+    void *cpuPtr = nullptr;
+};
+
 class DrmGemCloseWorker {
   public:
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
@@ -33,19 +42,22 @@ class DrmGemCloseWorker {
     DrmGemCloseWorker &operator=(const DrmGemCloseWorker &) = delete;
 
     void push(BufferObject *allocation);
+    void push(BufferObject *const *bufferObjects, size_t bufferObjectsCount, const DeferredGpuRange &gpuRange);
     void close(bool blocking);
 
     bool isEmpty();
 
   protected:
     void close(BufferObject *workItem);
+    void processBatch(std::vector<BufferObject *> &bufferObjects, std::vector<DeferredGpuRange> &gpuRanges);
     void closeThread();
     static void *worker(void *arg);
     bool active = true;
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    std::vector<BufferObject *> queue;
+    std::vector<DeferredGpuRange> gpuRangesQueue;
     std::atomic<uint32_t> workCount{0};
 
     DrmMemoryManager &memoryManager;
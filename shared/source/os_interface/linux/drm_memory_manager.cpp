@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm.h"
@@ -40,6 +41,20 @@ DrmMemoryManager::DrmMemoryManager(gemCloseWorkerMode mode,
         getGfxPartition(rootDeviceIndex)->init(gpuAddressSpace, getSizeToReserve(), rootDeviceIndex, gfxPartitions.size());
     }
     MemoryManager::virtualPaddingAvailable = true;
+
+    if (DebugManager.flags.EnableUserptrBoCache.get() == 1) {
+        size_t maxCachedSize = 64 * MemoryConstants::megaByte;
+        if (DebugManager.flags.UserptrBoCacheMaxSizeInKb.get() != -1) {
+            maxCachedSize = static_cast<size_t>(DebugManager.flags.UserptrBoCacheMaxSizeInKb.get()) * MemoryConstants::kiloByte;
+        }
+        std::chrono::milliseconds idleTimeout{1000};
+        if (DebugManager.flags.UserptrBoCacheIdleTimeoutMs.get() != -1) {
+            idleTimeout = std::chrono::milliseconds{DebugManager.flags.UserptrBoCacheIdleTimeoutMs.get()};
+        }
+        userptrCache = std::make_unique<UserptrBufferObjectCache>(maxCachedSize, idleTimeout);
+    }
+
+    // created after userptr cache, gem close worker trims its idle entries
     if (mode != gemCloseWorkerMode::gemCloseWorkerInactive) {
         gemCloseWorker.reset(new DrmGemCloseWorker(*this));
     }
@@ -70,6 +85,7 @@ DrmMemoryManager::~DrmMemoryManager() {
 }
 
 void DrmMemoryManager::commonCleanup() {
+    trimUserptrCache();
     if (gemCloseWorker) {
         gemCloseWorker->close(false);
     }
@@ -182,12 +198,47 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(allocationData.size, minAlignment), minAlignment);
 
-    auto res = alignedMallocWrapper(cSize, cAlignment);
+    auto svmCpuAllocation = allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU;
+    auto useHugePages = isHugePageAllocationPreferred(cSize);
+    if (useHugePages) {
+        cAlignment = std::max(cAlignment, MemoryConstants::pageSize2Mb);
+        cSize = alignUp(cSize, MemoryConstants::pageSize2Mb);
+    }
+    // cached entries are bucketed by size class, so the underlying memory and BO are rounded up to it
+    auto userptrCacheable = userptrCache && !svmCpuAllocation && !useHugePages && userptrCache->isCacheable(cSize);
+    size_t boSize = userptrCacheable ? UserptrBufferObjectCache::getSizeClass(cSize) : cSize;
+
+    if (userptrCacheable) {
+        UserptrBufferObjectCache::Entry entry;
+        std::vector<UserptrBufferObjectCache::Entry> evictedEntries;
+        auto reused = userptrCache->tryReuse(allocationData.rootDeviceIndex, boSize, cAlignment, std::chrono::steady_clock::now(), entry, evictedEntries);
+        releaseUserptrCacheEntries(evictedEntries);
+        if (reused) {
+            emitPinningRequest(entry.bo, allocationData);
+
+            auto allocation = new DrmAllocation(allocationData.rootDeviceIndex, allocationData.type, entry.bo, entry.cpuPtr, entry.bo->gpuAddress, cSize, MemoryPool::System4KBPages);
+            allocation->setDriverAllocatedCpuPtr(entry.cpuPtr);
+            allocation->setReservedAddressRange(reinterpret_cast<void *>(entry.reservedGpuAddress), entry.reservedSize);
+            allocation->setUserptrCacheable(true);
+            return allocation;
+        }
+    }
+
+    auto allocateHostMemory = [&]() {
+        return useHugePages ? allocateHugePageSystemMemory(boSize, cAlignment) : alignedMallocWrapper(boSize, cAlignment);
+    };
+    auto res = allocateHostMemory();
+    if (!res && trimUserptrCache()) {
+        res = allocateHostMemory();
+    }
 
     if (!res)
         return nullptr;
 
-    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(res), cSize, 0, allocationData.rootDeviceIndex);
+    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(res), boSize, 0, allocationData.rootDeviceIndex);
+    if (!bo && trimUserptrCache()) {
+        bo = allocUserptr(reinterpret_cast<uintptr_t>(res), boSize, 0, allocationData.rootDeviceIndex);
+    }
 
     if (!bo) {
         alignedFreeWrapper(res);
@@ -196,8 +247,7 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
 
     // if limitedRangeAlloction is enabled, memory allocation for bo in the limited Range heap is required
     uint64_t gpuAddress = 0;
-    size_t alignedSize = cSize;
-    auto svmCpuAllocation = allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU;
+    size_t alignedSize = boSize;
     if (svmCpuAllocation) {
         //add 2MB padding in case reserved addr is not 2MB aligned
         alignedSize = alignUp(cSize, cAlignment) + cAlignment;
@@ -221,10 +271,12 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
 
     emitPinningRequest(bo, allocationData);
 
-    auto allocation = new DrmAllocation(allocationData.rootDeviceIndex, allocationData.type, bo, res, bo->gpuAddress, cSize, MemoryPool::System4KBPages);
+    auto memoryPool = useHugePages ? MemoryPool::System2MBPages : MemoryPool::System4KBPages;
+    auto allocation = new DrmAllocation(allocationData.rootDeviceIndex, allocationData.type, bo, res, bo->gpuAddress, cSize, memoryPool);
     allocation->setDriverAllocatedCpuPtr(res);
 
     allocation->setReservedAddressRange(reinterpret_cast<void *>(gpuAddress), alignedSize);
+    allocation->setUserptrCacheable(userptrCacheable);
 
     return allocation;
 }
@@ -556,6 +608,11 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
     if (gfxAllocation->fragmentsStorage.fragmentCount) {
         cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
     } else {
+        if (storeInUserptrCache(*static_cast<DrmAllocation *>(gfxAllocation)) ||
+            deferBufferObjectsClose(*static_cast<DrmAllocation *>(gfxAllocation))) {
+            delete gfxAllocation;
+            return;
+        }
         auto &bos = static_cast<DrmAllocation *>(gfxAllocation)->getBOs();
         for (auto bo : bos) {
             unreference(bo, bo && bo->isReused ? false : true);
@@ -571,6 +628,85 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
     delete gfxAllocation;
 }
 
+bool DrmMemoryManager::storeInUserptrCache(DrmAllocation &allocation) {
+    if (!userptrCache || !allocation.isUserptrCacheable()) {
+        return false;
+    }
+    auto bo = allocation.getBO();
+    // BO still referenced elsewhere (e.g. by gem close worker) can't be handed out again
+    if (bo->getRefCount() != 1 || bo->peekIsReusableAllocation() || allocation.peekSharedHandle() != Sharing::nonSharedResource) {
+        return false;
+    }
+
+    UserptrBufferObjectCache::Entry entry;
+    entry.cpuPtr = allocation.getDriverAllocatedCpuPtr();
+    entry.bo = bo;
+    entry.reservedGpuAddress = castToUint64(allocation.getReservedAddressPtr());
+    entry.reservedSize = allocation.getReservedAddressSize();
+    entry.size = static_cast<size_t>(bo->peekSize());
+    entry.rootDeviceIndex = allocation.getRootDeviceIndex();
+
+    std::vector<UserptrBufferObjectCache::Entry> evictedEntries;
+    userptrCache->store(entry, std::chrono::steady_clock::now(), evictedEntries);
+    releaseUserptrCacheEntries(evictedEntries);
+    return true;
+}
+
+bool DrmMemoryManager::deferBufferObjectsClose(DrmAllocation &allocation) {
+    if (!gemCloseWorker || DebugManager.flags.EnableDeferredBufferObjectClose.get() != 1) {
+        return false;
+    }
+    if (allocation.peekSharedHandle() != Sharing::nonSharedResource) {
+        return false;
+    }
+    auto &bos = allocation.getBOs();
+    for (auto bo : bos) {
+        if (bo && bo->peekIsReusableAllocation()) {
+            return false;
+        }
+    }
+
+    DeferredGpuRange gpuRange;
+    gpuRange.address = allocation.getReservedAddressPtr();
+    gpuRange.size = allocation.getReservedAddressSize();
+    gpuRange.rootDeviceIndex = allocation.getRootDeviceIndex();
+    gpuRange.cpuPtr = allocation.getDriverAllocatedCpuPtr();
+    gemCloseWorker->push(bos.data(), bos.size(), gpuRange);
+    return true;
+}
+
+void DrmMemoryManager::releaseDeferredGpuRange(const DeferredGpuRange &gpuRange) {
+    releaseGpuRange(gpuRange.address, gpuRange.size, gpuRange.rootDeviceIndex);
+    alignedFreeWrapper(gpuRange.cpuPtr);
+}
+
+bool DrmMemoryManager::trimUserptrCache() {
+    if (!userptrCache) {
+        return false;
+    }
+    std::vector<UserptrBufferObjectCache::Entry> evictedEntries;
+    userptrCache->trimAll(evictedEntries);
+    releaseUserptrCacheEntries(evictedEntries);
+    return !evictedEntries.empty();
+}
+
+void DrmMemoryManager::trimIdleUserptrCacheEntries() {
+    if (!userptrCache) {
+        return;
+    }
+    std::vector<UserptrBufferObjectCache::Entry> evictedEntries;
+    userptrCache->trim(std::chrono::steady_clock::now(), evictedEntries);
+    releaseUserptrCacheEntries(evictedEntries);
+}
+
+void DrmMemoryManager::releaseUserptrCacheEntries(const std::vector<UserptrBufferObjectCache::Entry> &entries) {
+    for (auto &entry : entries) {
+        unreference(entry.bo, true);
+        releaseGpuRange(reinterpret_cast<void *>(entry.reservedGpuAddress), entry.reservedSize, entry.rootDeviceIndex);
+        alignedFreeWrapper(entry.cpuPtr);
+    }
+}
+
 void DrmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
     static_cast<DrmAllocation *>(allocation)->getBO()->wait(-1);
 }
@@ -726,6 +862,7 @@ int DrmMemoryManager::obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex)
 }
 
 uint32_t DrmMemoryManager::getDefaultDrmContextId() const {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     auto osContextLinux = static_cast<OsContextLinux *>(registeredEngines[defaultEngineIndex].osContext);
     return osContextLinux->getDrmContextIds()[0];
 }
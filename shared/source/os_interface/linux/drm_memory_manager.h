@@ -10,6 +10,7 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/userptr_buffer_object_cache.h"
 
 #include "drm_gem_close_worker.h"
 
@@ -45,6 +46,7 @@ class DrmMemoryManager : public MemoryManager {
 
     // drm/i915 ioctl wrappers
     MOCKABLE_VIRTUAL uint32_t unreference(BufferObject *bo, bool synchronousDestroy);
+    void releaseDeferredGpuRange(const DeferredGpuRange &gpuRange);
 
     bool isValidateHostMemoryEnabled() const {
         return validateHostPtrMemory;
@@ -55,6 +57,9 @@ class DrmMemoryManager : public MemoryManager {
 
     int obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex);
 
+    UserptrBufferObjectCache *peekUserptrCache() const { return this->userptrCache.get(); }
+    void trimIdleUserptrCacheEntries();
+
   protected:
     BufferObject *findAndReferenceSharedBufferObject(int boHandle);
     BufferObject *createSharedBufferObject(int boHandle, size_t size, bool requireSpecificBitness, uint32_t rootDeviceIndex);
@@ -66,6 +71,10 @@ class DrmMemoryManager : public MemoryManager {
     MOCKABLE_VIRTUAL void releaseGpuRange(void *address, size_t size, uint32_t rootDeviceIndex);
     void emitPinningRequest(BufferObject *bo, const AllocationData &allocationData) const;
     uint32_t getDefaultDrmContextId() const;
+    bool storeInUserptrCache(DrmAllocation &allocation);
+    bool deferBufferObjectsClose(DrmAllocation &allocation);
+    bool trimUserptrCache();
+    void releaseUserptrCacheEntries(const std::vector<UserptrBufferObjectCache::Entry> &entries);
 
     DrmAllocation *createGraphicsAllocation(OsHandleStorage &handleStorage, const AllocationData &allocationData) override;
     DrmAllocation *allocateGraphicsMemoryForNonSvmHostPtr(const AllocationData &allocationData) override;
@@ -90,6 +99,7 @@ class DrmMemoryManager : public MemoryManager {
     size_t pinThreshold = 8 * 1024 * 1024;
     bool forcePinEnabled = false;
     const bool validateHostPtrMemory;
+    std::unique_ptr<UserptrBufferObjectCache> userptrCache;
     std::unique_ptr<DrmGemCloseWorker> gemCloseWorker;
     decltype(&lseek) lseekFunction = lseek;
     decltype(&close) closeFunction = close;
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 
 #include <dlfcn.h>
+#include <link.h>
 
 namespace NEO {
 OsLibrary *OsLibrary::load(const std::string &name) {
@@ -54,5 +55,13 @@ void *OsLibrary::getProcAddress(const std::string &procName) {
 
     return dlsym(this->handle, procName.c_str());
 }
+
+std::string OsLibrary::getFullPath() {
+    struct link_map *linkMap = nullptr;
+    if ((this->handle == nullptr) || (dlinfo(this->handle, RTLD_DI_LINKMAP, &linkMap) != 0) || (linkMap == nullptr) || (linkMap->l_name == nullptr)) {
+        return std::string();
+    }
+    return std::string(linkMap->l_name);
+}
 } // namespace Linux
 } // namespace NEO
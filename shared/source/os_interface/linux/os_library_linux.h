@@ -21,6 +21,7 @@ class OsLibrary : public NEO::OsLibrary {
 
     bool isLoaded() override;
     void *getProcAddress(const std::string &procName) override;
+    std::string getFullPath() override;
 };
 } // namespace Linux
 } // namespace NEO
@@ -21,6 +21,10 @@ void OSMemoryLinux::releaseCpuAddressRange(void *reservedCpuAddressRange, size_t
     munmapWrapper(reservedCpuAddressRange, reservedSize);
 }
 
+void OSMemoryLinux::adviseHugePages(void *address, size_t size) {
+    madviseWrapper(address, size, MADV_HUGEPAGE);
+}
+
 void *OSMemoryLinux::mmapWrapper(void *addr, size_t size, int prot, int flags, int fd, off_t off) {
     return mmap(addr, size, prot, flags, fd, off);
 }
@@ -29,4 +33,8 @@ int OSMemoryLinux::munmapWrapper(void *addr, size_t size) {
     return munmap(addr, size);
 }
 
+int OSMemoryLinux::madviseWrapper(void *addr, size_t size, int advice) {
+    return madvise(addr, size, advice);
+}
+
 } // namespace NEO
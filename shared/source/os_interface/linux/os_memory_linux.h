@@ -17,10 +17,12 @@ class OSMemoryLinux : public OSMemory {
     OSMemoryLinux() = default;
     void *reserveCpuAddressRange(size_t sizeToReserve) override;
     void releaseCpuAddressRange(void *reservedCpuAddressRange, size_t reservedSize) override;
+    void adviseHugePages(void *address, size_t size) override;
 
   protected:
     MOCKABLE_VIRTUAL void *mmapWrapper(void *, size_t, int, int, int, off_t);
     MOCKABLE_VIRTUAL int munmapWrapper(void *, size_t);
+    MOCKABLE_VIRTUAL int madviseWrapper(void *, size_t, int);
 };
 
 } // namespace NEO
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/userptr_buffer_object_cache.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/memory_manager/memory_constants.h"
+
+namespace NEO {
+
+size_t UserptrBufferObjectCache::getSizeClass(size_t size) {
+    if (size <= MemoryConstants::pageSize64k) {
+        return alignUp(size, MemoryConstants::pageSize);
+    }
+    if (size <= MemoryConstants::megaByte) {
+        return alignUp(size, MemoryConstants::pageSize64k);
+    }
+    // split every power of two into 4 classes, wasting at most 25% of memory
+    auto granularity = static_cast<size_t>(Math::prevPowerOfTwo(static_cast<uint64_t>(size))) / 4;
+    return alignUp(size, granularity);
+}
+
+bool UserptrBufferObjectCache::tryReuse(uint32_t rootDeviceIndex, size_t size, size_t alignment, TimePoint now, Entry &outEntry, std::vector<Entry> &outEvicted) {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimIdleEntries(now, outEvicted);
+
+    auto bucket = buckets.find(BucketKey{rootDeviceIndex, size});
+    if (bucket == buckets.end()) {
+        return false;
+    }
+
+    auto &entries = bucket->second;
+    // most recently used entries first, their memory is most likely still in CPU caches
+    for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+        if (isAligned(reinterpret_cast<uintptr_t>(it->cpuPtr), alignment)) {
+            outEntry = *it;
+            entries.erase(std::next(it).base());
+            if (entries.empty()) {
+                buckets.erase(bucket);
+            }
+            cachedSize -= outEntry.size;
+            return true;
+        }
+    }
+    return false;
+}
+
+void UserptrBufferObjectCache::store(const Entry &entry, TimePoint now, std::vector<Entry> &outEvicted) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &entries = buckets[BucketKey{entry.rootDeviceIndex, entry.size}];
+    entries.push_back(entry);
+    entries.rbegin()->lastUsed = now;
+    cachedSize += entry.size;
+
+    trimIdleEntries(now, outEvicted);
+    if (cachedSize > maxCachedSize) {
+        trimToSize(maxCachedSize, outEvicted);
+    }
+}
+
+void UserptrBufferObjectCache::trim(TimePoint now, std::vector<Entry> &outEvicted) {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimIdleEntries(now, outEvicted);
+}
+
+void UserptrBufferObjectCache::trimAll(std::vector<Entry> &outEvicted) {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimToSize(0u, outEvicted);
+}
+
+size_t UserptrBufferObjectCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t entriesCount = 0u;
+    for (auto &bucket : buckets) {
+        entriesCount += bucket.second.size();
+    }
+    return entriesCount;
+}
+
+void UserptrBufferObjectCache::trimIdleEntries(TimePoint now, std::vector<Entry> &outEvicted) {
+    for (auto bucket = buckets.begin(); bucket != buckets.end();) {
+        auto &entries = bucket->second;
+        auto firstActive = entries.begin();
+        while ((firstActive != entries.end()) && (now - firstActive->lastUsed > idleTimeout)) {
+            cachedSize -= firstActive->size;
+            outEvicted.push_back(*firstActive);
+            ++firstActive;
+        }
+        entries.erase(entries.begin(), firstActive);
+        bucket = entries.empty() ? buckets.erase(bucket) : std::next(bucket);
+    }
+}
+
+void UserptrBufferObjectCache::trimToSize(size_t targetSize, std::vector<Entry> &outEvicted) {
+    while (cachedSize > targetSize) {
+        auto oldestBucket = buckets.begin();
+        for (auto bucket = buckets.begin(); bucket != buckets.end(); ++bucket) {
+            if (bucket->second.begin()->lastUsed < oldestBucket->second.begin()->lastUsed) {
+                oldestBucket = bucket;
+            }
+        }
+        auto &entries = oldestBucket->second;
+        cachedSize -= entries.begin()->size;
+        outEvicted.push_back(*entries.begin());
+        entries.erase(entries.begin());
+        if (entries.empty()) {
+            buckets.erase(oldestBucket);
+        }
+    }
+}
+} // namespace NEO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class BufferObject;
+
+// Keeps idle (host memory, userptr BO, GPU VA range) triples of freed allocations so that
+// allocations of the same size class can reuse them without malloc/GEM_USERPTR/VA reservation.
+// Entries are trimmed when they stay idle longer than idleTimeout or when cache exceeds maxCachedSize.
+class UserptrBufferObjectCache {
+  public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    struct Entry {
+        void *cpuPtr = nullptr;
+        BufferObject *bo = nullptr;
+        uint64_t reservedGpuAddress = 0u;
+        size_t reservedSize = 0u;
+        size_t size = 0u;
+        uint32_t rootDeviceIndex = 0u;
+        TimePoint lastUsed;
+    };
+
+    UserptrBufferObjectCache(size_t maxCachedSize, std::chrono::milliseconds idleTimeout)
+        : maxCachedSize(maxCachedSize), idleTimeout(idleTimeout) {}
+
+    static size_t getSizeClass(size_t size);
+
+    bool isCacheable(size_t size) const {
+        return getSizeClass(size) <= maxCachedSize;
+    }
+
+    bool tryReuse(uint32_t rootDeviceIndex, size_t size, size_t alignment, TimePoint now, Entry &outEntry, std::vector<Entry> &outEvicted);
+    void store(const Entry &entry, TimePoint now, std::vector<Entry> &outEvicted);
+    void trim(TimePoint now, std::vector<Entry> &outEvicted);
+    void trimAll(std::vector<Entry> &outEvicted);
+
+    size_t getCachedSize() const {
+        return cachedSize;
+    }
+    size_t getEntriesCount() const;
+    std::chrono::milliseconds getIdleTimeout() const {
+        return idleTimeout;
+    }
+
+  protected:
+    using BucketKey = std::pair<uint32_t, size_t>;
+
+    void trimIdleEntries(TimePoint now, std::vector<Entry> &outEvicted);
+    void trimToSize(size_t targetSize, std::vector<Entry> &outEvicted);
+
+    // every bucket is ordered by lastUsed, oldest entries first
+    std::map<BucketKey, std::vector<Entry>> buckets;
+    size_t cachedSize = 0u;
+    const size_t maxCachedSize;
+    const std::chrono::milliseconds idleTimeout;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -38,5 +38,6 @@ class OsLibrary {
     }
     virtual void *getProcAddress(const std::string &procName) = 0;
     virtual bool isLoaded() = 0;
+    virtual std::string getFullPath() { return std::string(); }
 };
 } // namespace NEO
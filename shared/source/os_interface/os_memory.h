@@ -18,6 +18,7 @@ struct OSMemory {
     virtual ~OSMemory() = default;
     virtual void *reserveCpuAddressRange(size_t sizeToReserve) = 0;
     virtual void releaseCpuAddressRange(void *reservedCpuAddressRange, size_t reservedSize) = 0;
+    virtual void adviseHugePages(void *address, size_t size) = 0;
 };
 
 } // namespace NEO
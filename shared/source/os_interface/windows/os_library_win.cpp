@@ -65,5 +65,14 @@ bool OsLibrary::isLoaded() {
 void *OsLibrary::getProcAddress(const std::string &procName) {
     return ::GetProcAddress(this->handle, procName.c_str());
 }
+
+std::string OsLibrary::getFullPath() {
+    char dllPath[MAX_PATH];
+    DWORD length = getModuleFileNameA(this->handle, dllPath, MAX_PATH);
+    if ((length == 0) || (length >= MAX_PATH)) {
+        return std::string();
+    }
+    return std::string(dllPath, length);
+}
 } // namespace Windows
 } // namespace NEO
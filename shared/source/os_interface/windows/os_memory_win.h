@@ -16,6 +16,7 @@ class OSMemoryWindows : public OSMemory {
     OSMemoryWindows() = default;
     void *reserveCpuAddressRange(size_t sizeToReserve) override;
     void releaseCpuAddressRange(void *reservedCpuAddressRange, size_t reservedSize) override;
+    void adviseHugePages(void *address, size_t size) override {}
 
   protected:
     MOCKABLE_VIRTUAL LPVOID virtualAllocWrapper(LPVOID, SIZE_T, DWORD, DWORD);
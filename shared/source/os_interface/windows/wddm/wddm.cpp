@@ -27,7 +27,9 @@
 #include "shared/source/os_interface/windows/wddm_engine_mapper.h"
 #include "shared/source/os_interface/windows/wddm_residency_allocations_container.h"
 #include "shared/source/sku_info/operations/windows/sku_info_receiver.h"
+#include "shared/source/utilities/runtime_counters.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "gmm_memory.h"
 
@@ -771,7 +773,11 @@ bool Wddm::submit(uint64_t commandBuffer, size_t size, void *commandHeader, Wddm
     }
     DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "currentFenceValue =", submitArguments.monitorFence->currentFenceValue);
 
-    status = wddmInterface->submit(commandBuffer, size, commandHeader, submitArguments);
+    {
+        TraceRecorderScope traceRecorderScope(TraceCategory::system, "submitCommand");
+        RuntimeCounters::increment(RuntimeCounter::execCalls);
+        status = wddmInterface->submit(commandBuffer, size, commandHeader, submitArguments);
+    }
     if (status) {
         submitArguments.monitorFence->lastSubmittedFence = submitArguments.monitorFence->currentFenceValue;
         submitArguments.monitorFence->currentFenceValue++;
@@ -320,7 +320,7 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
     WddmAllocation *input = static_cast<WddmAllocation *>(gfxAllocation);
     DEBUG_BREAK_IF(!validateAllocation(input));
 
-    for (auto &engine : this->registeredEngines) {
+    for (auto &engine : getRegisteredEnginesSnapshot()) {
         auto &residencyController = static_cast<OsContextWin *>(engine.osContext)->getResidencyController();
         auto lock = residencyController.acquireLock();
         residencyController.removeFromTrimCandidateListIfUsed(input, true);
@@ -369,7 +369,7 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
 
 void WddmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
     auto wddmAllocation = static_cast<WddmAllocation *>(allocation);
-    for (auto &engine : this->registeredEngines) {
+    for (auto &engine : getRegisteredEnginesSnapshot()) {
         const auto lastFenceValue = wddmAllocation->getResidencyData().getFenceValueForContextId(engine.osContext->getContextId());
         if (lastFenceValue != 0u) {
             const auto &monitoredFence = static_cast<OsContextWin *>(engine.osContext)->getResidencyController().getMonitoredFence();
@@ -390,7 +390,7 @@ bool WddmMemoryManager::tryDeferDeletions(const D3DKMT_HANDLE *handles, uint32_t
 }
 
 bool WddmMemoryManager::isMemoryBudgetExhausted() const {
-    for (auto &engine : this->registeredEngines) {
+    for (auto &engine : getRegisteredEnginesSnapshot()) {
         if (static_cast<OsContextWin *>(engine.osContext)->getResidencyController().isMemoryBudgetExhausted()) {
             return true;
         }
@@ -7,17 +7,44 @@
 
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace NEO {
+size_t PageFaultManager::getChunkSize() {
+    auto chunkSizeInKb = DebugManager.flags.PageFaultManagerChunkSizeInKb.get();
+    if (chunkSizeInKb <= 0) {
+        return 0u;
+    }
+    return alignUp(static_cast<size_t>(chunkSizeInKb) * MemoryConstants::kiloByte, MemoryConstants::pageSize);
+}
+
+size_t PageFaultManager::getChunkLength(const PageFaultData &pageFaultData, size_t chunkId) {
+    auto chunkOffset = chunkId * pageFaultData.chunkSize;
+    return std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+}
+
 void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ) {
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, false}));
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, false};
+    auto chunkSize = getChunkSize();
+    if (chunkSize != 0 && size > chunkSize) {
+        // New allocation starts in cpu domain mapped as a whole, chunks are tracked after its first migration to gpu.
+        pageFaultData.chunkSize = chunkSize;
+        pageFaultData.chunks.resize(Math::divideAndRoundUp(size, chunkSize), ChunkState::cpuDirty);
+        pageFaultData.isMappedAsWhole = true;
+    }
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
+    this->trackCpuDomainAllocation(ptr, unifiedMemoryManager);
     this->transferToCpu(ptr, size, cmdQ);
 }
 
@@ -26,9 +53,10 @@ void PageFaultManager::removeAllocation(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.isInGpuDomain) {
+        if (pageFaultData.isInGpuDomain || !pageFaultData.chunks.empty()) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         }
+        this->untrackCpuDomainAllocation(ptr, pageFaultData.unifiedMemoryManager);
         this->memoryData.erase(ptr);
     }
 }
@@ -37,44 +65,123 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
-        auto &pageFaultData = alloc->second;
-        if (pageFaultData.isInGpuDomain == false) {
-            this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
-            this->transferToGpu(ptr, pageFaultData.cmdQ);
-            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
-            pageFaultData.isInGpuDomain = true;
-        }
+        this->migrateToGpuDomain(ptr, alloc->second);
     }
 }
 
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (pageFaultData.unifiedMemoryManager == unifiedMemoryManager && pageFaultData.isInGpuDomain == false) {
-            this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
-            this->transferToGpu(allocPtr, pageFaultData.cmdQ);
-            this->protectCPUMemoryAccess(allocPtr, pageFaultData.size);
-            pageFaultData.isInGpuDomain = true;
+    auto cpuDomainAllocs = this->cpuDomainAllocations.find(unifiedMemoryManager);
+    if (cpuDomainAllocs == this->cpuDomainAllocations.end()) {
+        return;
+    }
+    // Only allocations touched by cpu since the last migration are visited, not every tracked allocation.
+    std::unordered_set<void *> allocsToMigrate;
+    allocsToMigrate.swap(cpuDomainAllocs->second);
+    for (auto allocPtr : allocsToMigrate) {
+        auto alloc = memoryData.find(allocPtr);
+        if (alloc != memoryData.end()) {
+            this->migrateToGpuDomain(allocPtr, alloc->second);
+        }
+    }
+}
+
+void PageFaultManager::trackCpuDomainAllocation(void *ptr, SVMAllocsManager *unifiedMemoryManager) {
+    this->cpuDomainAllocations[unifiedMemoryManager].insert(ptr);
+}
+
+void PageFaultManager::untrackCpuDomainAllocation(void *ptr, SVMAllocsManager *unifiedMemoryManager) {
+    auto cpuDomainAllocs = this->cpuDomainAllocations.find(unifiedMemoryManager);
+    if (cpuDomainAllocs != this->cpuDomainAllocations.end()) {
+        cpuDomainAllocs->second.erase(ptr);
+    }
+}
+
+void PageFaultManager::migrateToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    if (pageFaultData.isInGpuDomain) {
+        return;
+    }
+    this->untrackCpuDomainAllocation(ptr, pageFaultData.unifiedMemoryManager);
+    this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
+
+    if (pageFaultData.chunks.empty() || pageFaultData.isMappedAsWhole) {
+        this->transferToGpu(ptr, pageFaultData.cmdQ);
+        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        std::fill(pageFaultData.chunks.begin(), pageFaultData.chunks.end(), ChunkState::gpu);
+        pageFaultData.isMappedAsWhole = false;
+        pageFaultData.isInGpuDomain = true;
+        return;
+    }
+
+    // Only chunks touched by cpu are migrated and waited for once, only dirty ones are copied back to gpu.
+    std::vector<void *> cleanChunkPtrs;
+    std::vector<void *> dirtyChunkPtrs;
+    std::vector<std::pair<size_t, size_t>> rangesToProtect;
+    for (size_t chunkId = 0; chunkId < pageFaultData.chunks.size(); chunkId++) {
+        if (pageFaultData.chunks[chunkId] == ChunkState::gpu) {
+            continue;
         }
+        auto chunkOffset = chunkId * pageFaultData.chunkSize;
+        auto &chunkPtrs = pageFaultData.chunks[chunkId] == ChunkState::cpuDirty ? dirtyChunkPtrs : cleanChunkPtrs;
+        chunkPtrs.push_back(ptrOffset(ptr, chunkOffset));
+        pageFaultData.chunks[chunkId] = ChunkState::gpu;
+        if (!rangesToProtect.empty() && rangesToProtect.back().first + rangesToProtect.back().second == chunkOffset) {
+            rangesToProtect.back().second += getChunkLength(pageFaultData, chunkId);
+        } else {
+            rangesToProtect.emplace_back(chunkOffset, getChunkLength(pageFaultData, chunkId));
+        }
+    }
+    if (!cleanChunkPtrs.empty() || !dirtyChunkPtrs.empty()) {
+        this->transferChunksToGpu(cleanChunkPtrs, dirtyChunkPtrs, pageFaultData.cmdQ);
     }
+    for (auto &range : rangesToProtect) {
+        this->protectCPUMemoryAccess(ptrOffset(ptr, range.first), range.second);
+    }
+    pageFaultData.isInGpuDomain = true;
+}
+
+void PageFaultManager::handleChunkPageFault(void *allocPtr, PageFaultData &pageFaultData, void *faultPtr) {
+    auto chunkId = ptrDiff(faultPtr, allocPtr) / pageFaultData.chunkSize;
+    auto chunkPtr = ptrOffset(allocPtr, chunkId * pageFaultData.chunkSize);
+    auto chunkLength = getChunkLength(pageFaultData, chunkId);
+    auto &chunkState = pageFaultData.chunks[chunkId];
+
+    if (chunkState == ChunkState::gpu) {
+        // Chunk is brought to cpu read only, so the first write faults once more and marks it dirty.
+        this->allowCPUMemoryReadAccess(chunkPtr, chunkLength);
+        this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+        this->transferChunkToCpu(chunkPtr, chunkLength, pageFaultData.cmdQ);
+        chunkState = ChunkState::cpuClean;
+    } else if (chunkState == ChunkState::cpuClean) {
+        this->allowCPUMemoryAccess(chunkPtr, chunkLength);
+        chunkState = ChunkState::cpuDirty;
+    }
+    pageFaultData.isInGpuDomain = false;
+    this->trackCpuDomainAllocation(allocPtr, pageFaultData.unifiedMemoryManager);
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            this->transferToCpu(allocPtr, pageFaultData.size, pageFaultData.cmdQ);
-            pageFaultData.isInGpuDomain = false;
-            return true;
-        }
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return false;
+    }
+    --alloc;
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (ptr >= ptrOffset(allocPtr, pageFaultData.size)) {
+        return false;
+    }
+    if (!pageFaultData.chunks.empty()) {
+        this->handleChunkPageFault(allocPtr, pageFaultData, ptr);
+        return true;
     }
-    return false;
+    this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    this->transferToCpu(allocPtr, pageFaultData.size, pageFaultData.cmdQ);
+    pageFaultData.isInGpuDomain = false;
+    this->trackCpuDomainAllocation(allocPtr, pageFaultData.unifiedMemoryManager);
+    return true;
 }
 
 void PageFaultManager::setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) {
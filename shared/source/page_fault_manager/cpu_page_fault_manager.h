@@ -10,8 +10,11 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace NEO {
 class SVMAllocsManager;
@@ -27,23 +30,46 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ);
     void removeAllocation(void *ptr);
 
+    static size_t getChunkSize();
+
   protected:
+    // Chunk read by cpu stays PROT_READ until it is written, so syscalls writing into it (e.g. read(2)) fail with
+    // EFAULT instead of faulting; such buffers have to be written by cpu first or chunking disabled for them.
+    enum class ChunkState : uint8_t {
+        gpu,
+        cpuClean,
+        cpuDirty
+    };
+
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         bool isInGpuDomain;
+        size_t chunkSize = 0;
+        std::vector<ChunkState> chunks;
+        bool isMappedAsWhole = false;
     };
 
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
+    virtual void allowCPUMemoryReadAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferChunkToCpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferChunksToGpu(const std::vector<void *> &cleanChunkPtrs, const std::vector<void *> &dirtyChunkPtrs, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    void migrateToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void handleChunkPageFault(void *allocPtr, PageFaultData &pageFaultData, void *faultPtr);
+    static size_t getChunkLength(const PageFaultData &pageFaultData, size_t chunkId);
+    void trackCpuDomainAllocation(void *ptr, SVMAllocsManager *unifiedMemoryManager);
+    void untrackCpuDomainAllocation(void *ptr, SVMAllocsManager *unifiedMemoryManager);
+
+    std::map<void *, PageFaultData> memoryData;
+    std::unordered_map<SVMAllocsManager *, std::unordered_set<void *>> cpuDomainAllocations;
     SpinLock mtx;
 };
 } // namespace NEO
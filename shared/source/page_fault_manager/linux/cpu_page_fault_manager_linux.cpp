@@ -48,6 +48,11 @@ void PageFaultManagerLinux::allowCPUMemoryAccess(void *ptr, size_t size) {
     UNRECOVERABLE_IF(retVal != 0);
 }
 
+void PageFaultManagerLinux::allowCPUMemoryReadAccess(void *ptr, size_t size) {
+    auto retVal = mprotect(ptr, size, PROT_READ);
+    UNRECOVERABLE_IF(retVal != 0);
+}
+
 void PageFaultManagerLinux::protectCPUMemoryAccess(void *ptr, size_t size) {
     auto retVal = mprotect(ptr, size, PROT_NONE);
     UNRECOVERABLE_IF(retVal != 0);
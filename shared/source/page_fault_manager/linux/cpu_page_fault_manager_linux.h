@@ -22,6 +22,7 @@ class PageFaultManagerLinux : public PageFaultManager {
 
   protected:
     void allowCPUMemoryAccess(void *ptr, size_t size) override;
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override;
     void protectCPUMemoryAccess(void *ptr, size_t size) override;
 
     void callPreviousHandler(int signal, siginfo_t *info, void *context);
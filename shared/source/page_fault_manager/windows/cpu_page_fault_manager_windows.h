@@ -23,6 +23,7 @@ class PageFaultManagerWindows : public PageFaultManager {
 
   protected:
     void allowCPUMemoryAccess(void *ptr, size_t size) override;
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override;
     void protectCPUMemoryAccess(void *ptr, size_t size) override;
 
     static std::function<LONG(struct _EXCEPTION_POINTERS *exceptionInfo)> pageFaultHandler;
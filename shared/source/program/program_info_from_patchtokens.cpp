@@ -11,6 +11,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/kernel_info_from_patchtokens.h"
@@ -26,12 +27,7 @@ bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens
     return false;
 }
 
-void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
-    auto kernelInfo = std::make_unique<KernelInfo>();
-    const PatchTokenBinary::KernelFromPatchtokens &decodedKernel = decodedProgram.kernels[kernelNum];
-
-    NEO::populateKernelInfo(*kernelInfo, decodedKernel, decodedProgram.header->GPUPointerSizeInBytes);
-
+void populateSingleKernelLinkerInput(ProgramInfo &dst, const PatchTokenBinary::KernelFromPatchtokens &decodedKernel, uint32_t kernelNum) {
     if (decodedKernel.tokens.programSymbolTable) {
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeExportedFunctionsSymbolTable(decodedKernel.tokens.programSymbolTable + 1, decodedKernel.tokens.programSymbolTable->NumEntries, kernelNum);
@@ -41,13 +37,23 @@ void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramF
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeRelocationTable(decodedKernel.tokens.programRelocationTable + 1, decodedKernel.tokens.programRelocationTable->NumEntries, kernelNum);
     }
-
-    dst.kernelInfos.push_back(kernelInfo.release());
 }
 
 void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src) {
-    for (uint32_t i = 0; i < src.kernels.size(); ++i) {
-        populateSingleKernelInfo(dst, src, i);
+    auto kernelsCount = src.kernels.size();
+    auto firstKernelInfoIndex = dst.kernelInfos.size();
+    dst.kernelInfos.resize(firstKernelInfoIndex + kernelsCount, nullptr);
+
+    // kernel infos are independent of each other, linker input is shared so it's populated afterwards in kernels order
+    auto workersCount = (kernelsCount >= PatchTokenBinary::minKernelsCountForParallelDecode) ? getDefaultWorkersCount() : 1U;
+    parallelFor(kernelsCount, workersCount, [&](size_t kernelNum) {
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        NEO::populateKernelInfo(*kernelInfo, src.kernels[kernelNum], src.header->GPUPointerSizeInBytes);
+        dst.kernelInfos[firstKernelInfoIndex + kernelNum] = kernelInfo.release();
+    });
+
+    for (uint32_t i = 0; i < kernelsCount; ++i) {
+        populateSingleKernelLinkerInput(dst, src.kernels[i], i);
     }
 
     if (src.programScopeTokens.allocateConstantMemorySurface.empty() == false) {
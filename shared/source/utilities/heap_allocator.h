@@ -36,6 +36,10 @@ class HeapAllocator {
         freedChunksSmall.reserve(50);
     }
 
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : HeapAllocator(address, size, threshold) {
+        this->allocationAlignment = allocationAlignment;
+    }
+
     uint64_t allocate(size_t &sizeToAllocate) {
         sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_recorder.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <semaphore.h>
+#include <signal.h>
+#include <unistd.h>
+
+namespace NEO {
+
+namespace {
+std::atomic<TraceRecorder *> recorderToDump{nullptr};
+struct sigaction previousDumpSignalAction = {};
+sem_t dumpSemaphore;
+std::atomic<bool> dumpThreadRunning{false};
+std::unique_ptr<Thread> dumpThread;
+
+void dumpSignalHandler(int signal) {
+    // only wakes the dump thread, sem_post is async signal safe
+    sem_post(&dumpSemaphore);
+}
+
+void *dumpThreadBody(void *) {
+    while (true) {
+        if (sem_wait(&dumpSemaphore) != 0) {
+            continue;
+        }
+        if (!dumpThreadRunning.load()) {
+            return nullptr;
+        }
+        auto recorder = recorderToDump.load();
+        if (recorder) {
+            recorder->exportTraceToFile();
+        }
+    }
+}
+} // namespace
+
+void TraceRecorder::registerDumpSignalHandler(TraceRecorder &recorder) {
+    TraceRecorder *expected = nullptr;
+    if (!recorderToDump.compare_exchange_strong(expected, &recorder)) {
+        return;
+    }
+    sem_init(&dumpSemaphore, 0, 0);
+    dumpThreadRunning.store(true);
+    dumpThread = Thread::create(dumpThreadBody, nullptr);
+
+    struct sigaction action = {};
+    action.sa_handler = dumpSignalHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGUSR2, &action, &previousDumpSignalAction);
+}
+
+void TraceRecorder::unregisterDumpSignalHandler(TraceRecorder &recorder) {
+    if (recorderToDump.load() != &recorder) {
+        return;
+    }
+    sigaction(SIGUSR2, &previousDumpSignalAction, nullptr);
+
+    dumpThreadRunning.store(false);
+    sem_post(&dumpSemaphore);
+    dumpThread->join();
+    dumpThread.reset();
+    sem_destroy(&dumpSemaphore);
+    recorderToDump.store(nullptr);
+}
+
+uint32_t TraceRecorder::getProcessId() {
+    return static_cast<uint32_t>(getpid());
+}
+} // namespace NEO
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+constexpr size_t maxParallelForWorkersCount = 64U;
+
+inline size_t getDefaultWorkersCount() {
+    auto hwThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+    return std::max(hwThreads, static_cast<size_t>(1U));
+}
+
+// Calls func(jobId) for every jobId in [0, jobsCount) using up to workersCount threads
+// (including the calling thread), capped at maxParallelForWorkersCount. Jobs are handed out dynamically, so func must not
+// depend on the order in which jobs are executed.
+template <typename FuncT>
+void parallelFor(size_t jobsCount, size_t workersCount, FuncT &&func) {
+    workersCount = std::min({workersCount, jobsCount, maxParallelForWorkersCount});
+    if (workersCount <= 1) {
+        for (size_t jobId = 0; jobId < jobsCount; ++jobId) {
+            func(jobId);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextJobId{0U};
+    auto worker = [&]() {
+        for (size_t jobId = nextJobId++; jobId < jobsCount; jobId = nextJobId++) {
+            func(jobId);
+        }
+    };
+
+    std::vector<std::thread> helperThreads;
+    helperThreads.reserve(workersCount - 1);
+    for (size_t i = 1; i < workersCount; ++i) {
+        helperThreads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : helperThreads) {
+        thread.join();
+    }
+}
+
+} // namespace NEO
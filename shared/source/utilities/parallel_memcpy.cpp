@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_memcpy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+#include <emmintrin.h>
+
+namespace NEO {
+namespace ParallelMemcpy {
+
+bool isParallelCopyPreferred(size_t size) {
+    if (DebugManager.flags.EnableParallelMemcpy.get() == 0) {
+        return false;
+    }
+    size_t minSize = defaultMinSizeForParallelCopy;
+    if (DebugManager.flags.ParallelMemcpyMinSizeInKb.get() != -1) {
+        minSize = static_cast<size_t>(DebugManager.flags.ParallelMemcpyMinSizeInKb.get()) * MemoryConstants::kiloByte;
+    }
+    return size >= minSize && getWorkersCount(size) > 1U;
+}
+
+size_t getWorkersCount(size_t size) {
+    auto chunksCount = (size + chunkSize - 1) / chunkSize;
+    auto workersCount = std::max(chunksCount / minChunksPerWorker, static_cast<size_t>(1U));
+    return std::min(workersCount, getDefaultWorkersCount());
+}
+
+void copyNonTemporal(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = std::min(size, ptrDiff(alignUp(dstBytes, sizeof(__m128i)), dstBytes));
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    auto vectorsCount = size / sizeof(__m128i);
+    for (size_t i = 0; i < vectorsCount; i++) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+        dstBytes += sizeof(__m128i);
+        srcBytes += sizeof(__m128i);
+    }
+    memcpy(dstBytes, srcBytes, size - vectorsCount * sizeof(__m128i));
+    _mm_sfence();
+}
+} // namespace ParallelMemcpy
+
+int parallelMemcpy(void *dst, size_t destSize, const void *src, size_t count) {
+    if ((dst == nullptr) || (src == nullptr) || (destSize < count) || !ParallelMemcpy::isParallelCopyPreferred(count)) {
+        return memcpy_s(dst, destSize, src, count);
+    }
+
+    bool useNonTemporalStores = DebugManager.flags.ParallelMemcpyUseNonTemporalStores.get() != 0;
+    auto chunkSize = ParallelMemcpy::chunkSize;
+    auto firstChunkSize = std::min(count, ptrDiff(alignUp(ptrOffset(dst, 1), chunkSize), dst));
+    auto chunksCount = 1 + (count - firstChunkSize + chunkSize - 1) / chunkSize;
+
+    parallelFor(chunksCount, ParallelMemcpy::getWorkersCount(count), [&](size_t chunkId) {
+        size_t offset = (chunkId == 0) ? 0 : firstChunkSize + (chunkId - 1) * chunkSize;
+        size_t size = (chunkId == 0) ? firstChunkSize : std::min(chunkSize, count - offset);
+        if (useNonTemporalStores) {
+            ParallelMemcpy::copyNonTemporal(ptrOffset(dst, offset), ptrOffset(src, offset), size);
+        } else {
+            memcpy(ptrOffset(dst, offset), ptrOffset(src, offset), size);
+        }
+    });
+    return 0;
+}
+} // namespace NEO
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include <cstddef>
+
+namespace NEO {
+namespace ParallelMemcpy {
+constexpr size_t defaultMinSizeForParallelCopy = 4 * MemoryConstants::megaByte;
+constexpr size_t chunkSize = 1 * MemoryConstants::megaByte;
+constexpr size_t minChunksPerWorker = 2U;
+
+bool isParallelCopyPreferred(size_t size);
+size_t getWorkersCount(size_t size);
+void copyNonTemporal(void *dst, const void *src, size_t size);
+} // namespace ParallelMemcpy
+
+// memcpy_s compatible copy for large CPU transfers. Copies of at least ParallelMemcpy::defaultMinSizeForParallelCopy
+// bytes are split into page aligned chunks of the destination, so every destination page is written by exactly
+// one worker, and chunks are copied with non-temporal stores to avoid evicting the caller's working set.
+int parallelMemcpy(void *dst, size_t destSize, const void *src, size_t count);
+} // namespace NEO
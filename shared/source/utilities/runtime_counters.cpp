@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/runtime_counters.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace NEO {
+
+constexpr uint32_t RuntimeCounters::maxAllocationTypes;
+constexpr uint32_t RuntimeCounters::maxMemoryPools;
+constexpr uint32_t RuntimeCounters::allocationsByTypeIndex;
+constexpr uint32_t RuntimeCounters::allocationsByPoolIndex;
+constexpr uint32_t RuntimeCounters::valuesCount;
+constexpr uint32_t RuntimeCounters::shardsCount;
+
+RuntimeCounters::Shard RuntimeCounters::shards[RuntimeCounters::shardsCount];
+
+uint32_t RuntimeCounters::getShardIndex() {
+    // threads are assigned to shards round robin on their first increment
+    static std::atomic<uint32_t> nextShardIndex{0u};
+    thread_local uint32_t shardIndex = nextShardIndex.fetch_add(1u, std::memory_order_relaxed) % shardsCount;
+    return shardIndex;
+}
+
+uint64_t RuntimeCounters::sum(uint32_t index) {
+    uint64_t value = 0u;
+    for (auto &shard : shards) {
+        value += shard.values[index].load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+void RuntimeCounters::incrementAllocations(uint32_t allocationType, uint32_t memoryPool) {
+    // values out of range are accumulated in the last slot
+    add(static_cast<uint32_t>(RuntimeCounter::allocations), 1u);
+    add(allocationsByTypeIndex + std::min(allocationType, maxAllocationTypes - 1), 1u);
+    add(allocationsByPoolIndex + std::min(memoryPool, maxMemoryPools - 1), 1u);
+}
+
+uint64_t RuntimeCounters::getAllocationsByType(uint32_t allocationType) {
+    return sum(allocationsByTypeIndex + std::min(allocationType, maxAllocationTypes - 1));
+}
+
+uint64_t RuntimeCounters::getAllocationsByPool(uint32_t memoryPool) {
+    return sum(allocationsByPoolIndex + std::min(memoryPool, maxMemoryPools - 1));
+}
+
+const char *RuntimeCounters::getName(RuntimeCounter counter) {
+    switch (counter) {
+    case RuntimeCounter::flushTasks:
+        return "flushTasks";
+    case RuntimeCounter::execCalls:
+        return "execCalls";
+    case RuntimeCounter::bytesMadeResident:
+        return "bytesMadeResident";
+    case RuntimeCounter::allocations:
+        return "allocations";
+    case RuntimeCounter::tagAllocatorRefills:
+        return "tagAllocatorRefills";
+    case RuntimeCounter::reusableAllocationHits:
+        return "reusableAllocationHits";
+    case RuntimeCounter::compilerCacheHits:
+        return "compilerCacheHits";
+    case RuntimeCounter::compilerCacheMisses:
+        return "compilerCacheMisses";
+    case RuntimeCounter::waitSpinTimeNs:
+        return "waitSpinTimeNs";
+    default:
+        return "unknown";
+    }
+}
+
+size_t RuntimeCounters::getValues(uint64_t *outValues, size_t count) {
+    count = std::min(count, static_cast<size_t>(valuesCount));
+    for (size_t i = 0; i < count; i++) {
+        outValues[i] = sum(static_cast<uint32_t>(i));
+    }
+    return count;
+}
+
+std::string RuntimeCounters::getNames() {
+    std::stringstream names;
+    for (uint32_t i = 0; i < valuesCount; i++) {
+        if (i < allocationsByTypeIndex) {
+            names << getName(static_cast<RuntimeCounter>(i));
+        } else if (i < allocationsByPoolIndex) {
+            names << "allocationsByType[" << i - allocationsByTypeIndex << "]";
+        } else {
+            names << "allocationsByPool[" << i - allocationsByPoolIndex << "]";
+        }
+        names << "\n";
+    }
+    return names.str();
+}
+
+void RuntimeCounters::dump(std::ostream &out) {
+    uint64_t snapshot[valuesCount];
+    getValues(snapshot, valuesCount);
+
+    std::stringstream names(getNames());
+    std::string name;
+    for (uint32_t i = 0; i < valuesCount && std::getline(names, name); i++) {
+        // per type and per pool slots that were never used are skipped
+        if (i >= allocationsByTypeIndex && snapshot[i] == 0u) {
+            continue;
+        }
+        out << name << " = " << snapshot[i] << "\n";
+    }
+}
+
+bool RuntimeCounters::dumpToFile(const std::string &fileName) {
+    std::ofstream outFile(fileName, std::ios::out | std::ios::trunc);
+    if (!outFile.is_open()) {
+        return false;
+    }
+    dump(outFile);
+    return true;
+}
+
+void RuntimeCounters::registerDumpAtExit(const std::string &fileName) {
+    struct DumpAtExit {
+        ~DumpAtExit() {
+            dumpToFile(fileName);
+        }
+        std::string fileName;
+    };
+    // only the first registered file name is used
+    static DumpAtExit dumpAtExit{fileName};
+}
+
+void RuntimeCounters::reset() {
+    for (auto &shard : shards) {
+        for (auto &value : shard.values) {
+            value.store(0u, std::memory_order_relaxed);
+        }
+    }
+}
+} // namespace NEO
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace NEO {
+
+enum class RuntimeCounter : uint32_t {
+    flushTasks = 0,
+    execCalls,
+    bytesMadeResident,
+    allocations,
+    tagAllocatorRefills,
+    reusableAllocationHits,
+    compilerCacheHits,
+    compilerCacheMisses,
+    waitSpinTimeNs,
+    count
+};
+
+// Process-wide counters which are always collected. Values are split into shards, every thread
+// increments a relaxed atomic in the shard assigned to it and queries sum all shards, so threads
+// submitting concurrently don't bounce the same cache line unless they share a shard.
+// Allocations are additionally counted per allocation type and per memory pool.
+class RuntimeCounters {
+  public:
+    static constexpr uint32_t maxAllocationTypes = 64u;
+    static constexpr uint32_t maxMemoryPools = 16u;
+    static constexpr uint32_t allocationsByTypeIndex = static_cast<uint32_t>(RuntimeCounter::count);
+    static constexpr uint32_t allocationsByPoolIndex = allocationsByTypeIndex + maxAllocationTypes;
+    static constexpr uint32_t valuesCount = allocationsByPoolIndex + maxMemoryPools;
+    static constexpr uint32_t shardsCount = 16u;
+
+    static void increment(RuntimeCounter counter, uint64_t value = 1u) {
+        add(static_cast<uint32_t>(counter), value);
+    }
+    static void incrementAllocations(uint32_t allocationType, uint32_t memoryPool);
+
+    static uint64_t getValue(RuntimeCounter counter) {
+        return sum(static_cast<uint32_t>(counter));
+    }
+    static uint64_t getAllocationsByType(uint32_t allocationType);
+    static uint64_t getAllocationsByPool(uint32_t memoryPool);
+    static const char *getName(RuntimeCounter counter);
+
+    // Copies up to count values, in the order of names returned by getNames.
+    static size_t getValues(uint64_t *outValues, size_t count);
+    // Names of all values separated with new lines.
+    static std::string getNames();
+
+    static void dump(std::ostream &out);
+    static bool dumpToFile(const std::string &fileName);
+    static void registerDumpAtExit(const std::string &fileName);
+
+    static void reset();
+
+  protected:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> values[valuesCount];
+    };
+
+    static void add(uint32_t index, uint64_t value) {
+        shards[getShardIndex()].values[index].fetch_add(value, std::memory_order_relaxed);
+    }
+    static uint32_t getShardIndex();
+    static uint64_t sum(uint32_t index);
+
+    static Shard shards[shardsCount];
+};
+} // namespace NEO
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
+#include "shared/source/utilities/runtime_counters.h"
 
 #include <atomic>
 #include <cstdint>
@@ -44,10 +45,21 @@ struct TagNode : public IDNode<TagNode<TagType>> {
         doNotReleaseNodes = doNotRelease;
     }
 
+    // Nodes from one timeline are written in sequence order, each after all nodes with lower sequence
+    // were completed. Timeline 0 means that node is not ordered with any other node.
+    void setTimeline(uint64_t timelineId, uint64_t sequence) {
+        this->timelineId = timelineId;
+        this->timelineSequence = sequence;
+    }
+    uint64_t getTimelineId() const { return timelineId; }
+    uint64_t getTimelineSequence() const { return timelineSequence; }
+
   protected:
     TagAllocator<TagType> *allocator = nullptr;
     GraphicsAllocation *gfxAllocation = nullptr;
     uint64_t gpuAddress = 0;
+    uint64_t timelineId = 0;
+    uint64_t timelineSequence = 0;
     std::atomic<uint32_t> refCount{0};
     bool doNotReleaseNodes = false;
 
@@ -95,10 +107,12 @@ class TagAllocator {
         if (!node) {
             std::unique_lock<std::mutex> lock(allocatorMutex);
             populateFreeTags();
+            RuntimeCounters::increment(RuntimeCounter::tagAllocatorRefills);
             node = freeTags.removeFrontOne().release();
         }
         usedTags.pushFrontOne(*node);
         node->incRefCount();
+        node->setTimeline(0u, 0u);
         node->tagForCpuAccess->initialize();
         return node;
     }
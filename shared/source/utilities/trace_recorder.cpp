@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace NEO {
+
+std::atomic<uint64_t> TraceRecorder::recorderIdCounter{0u};
+
+namespace {
+// chrome trace timestamps are in microseconds
+std::string formatMicroseconds(uint64_t nanoseconds) {
+    char fraction[4] = {};
+    fraction[0] = static_cast<char>('0' + nanoseconds % 1000 / 100);
+    fraction[1] = static_cast<char>('0' + nanoseconds % 100 / 10);
+    fraction[2] = static_cast<char>('0' + nanoseconds % 10);
+    return std::to_string(nanoseconds / 1000) + "." + fraction;
+}
+} // namespace
+
+void TraceRecorderThreadBuffer::snapshot(std::vector<TraceRecord> &out) const {
+    auto capacity = static_cast<uint64_t>(records.size());
+    auto endIndex = writeIndex.load(std::memory_order_acquire);
+    auto beginIndex = endIndex > capacity ? endIndex - capacity : 0u;
+
+    auto firstCopied = out.size();
+    for (auto index = beginIndex; index < endIndex; index++) {
+        out.push_back(records[index % capacity]);
+    }
+
+    // records overwritten by the owning thread during the copy are dropped, including the one it may be writing now
+    auto indexAfterCopy = writeIndex.load(std::memory_order_acquire) + 1;
+    if (indexAfterCopy > beginIndex + capacity) {
+        auto overwrittenCount = std::min(indexAfterCopy - capacity - beginIndex, endIndex - beginIndex);
+        out.erase(out.begin() + firstCopied, out.begin() + firstCopied + static_cast<size_t>(overwrittenCount));
+    }
+}
+
+TraceRecorder &TraceRecorder::get() {
+    static TraceRecorder traceRecorder(DebugManager.flags.TraceRecorderRecordsPerThread.get() > 0
+                                           ? static_cast<size_t>(DebugManager.flags.TraceRecorderRecordsPerThread.get())
+                                           : defaultRecordsPerThread,
+                                       DebugManager.flags.TraceRecorderOutputFile.get());
+    return traceRecorder;
+}
+
+uint64_t TraceRecorder::getTimestamp() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+const char *TraceRecorder::getCategoryName(TraceCategory category) {
+    switch (category) {
+    case TraceCategory::api:
+        return "api";
+    case TraceCategory::enqueue:
+        return "enqueue";
+    case TraceCategory::submission:
+        return "submission";
+    case TraceCategory::system:
+        return "system";
+    case TraceCategory::gpu:
+        return "gpu";
+    default:
+        return "unknown";
+    }
+}
+
+TraceRecorder::TraceRecorder(size_t recordsPerThread, const std::string &outputFileName)
+    : recorderId(++recorderIdCounter), recordsPerThread(recordsPerThread), outputFileName(outputFileName) {
+}
+
+TraceRecorder::~TraceRecorder() {
+    unregisterDumpSignalHandler(*this);
+    if (!outputFileName.empty() && getThreadBuffersCount() > 0) {
+        exportTraceToFile();
+    }
+}
+
+TraceRecorderThreadBuffer &TraceRecorder::getThreadBuffer() {
+    // buffer is shared with the recorder, so it can be released on thread exit after the recorder is gone
+    struct CachedThreadBuffer {
+        ~CachedThreadBuffer() {
+            release();
+        }
+        void release() {
+            if (buffer) {
+                buffer->inUse.store(false, std::memory_order_release);
+                buffer.reset();
+            }
+        }
+
+        uint64_t recorderId = 0u;
+        std::shared_ptr<TraceRecorderThreadBuffer> buffer;
+    };
+    thread_local CachedThreadBuffer cached;
+
+    if (cached.recorderId != recorderId) {
+        cached.release();
+        cached.buffer = registerThreadBuffer();
+        cached.recorderId = recorderId;
+    }
+    return *cached.buffer;
+}
+
+std::shared_ptr<TraceRecorderThreadBuffer> TraceRecorder::registerThreadBuffer() {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (auto &buffer : buffers) {
+        bool inUse = false;
+        if (buffer->inUse.compare_exchange_strong(inUse, true, std::memory_order_acq_rel)) {
+            return buffer;
+        }
+    }
+    if (buffers.empty() && !outputFileName.empty()) {
+        registerDumpSignalHandler(*this);
+    }
+    // thread id 0 is reserved for gpu timeline
+    auto threadId = static_cast<uint32_t>(buffers.size()) + 1;
+    buffers.push_back(std::make_shared<TraceRecorderThreadBuffer>(threadId, recordsPerThread));
+    return buffers.back();
+}
+
+const char *TraceRecorder::storeName(const std::string &name) {
+    std::lock_guard<std::mutex> lock(namesMutex);
+    return names.insert(name).first->c_str();
+}
+
+size_t TraceRecorder::getThreadBuffersCount() const {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    return buffers.size();
+}
+
+void TraceRecorder::exportTrace(std::ostream &out) const {
+    auto processId = getProcessId();
+    std::vector<TraceRecord> records;
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"tid\":" << gpuThreadId << ",\"args\":{\"name\":\"GPU\"}}";
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (auto &buffer : buffers) {
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"tid\":" << buffer->getThreadId()
+            << ",\"args\":{\"name\":\"host thread " << buffer->getThreadId() << "\"}}";
+
+        records.clear();
+        buffer->snapshot(records);
+        for (auto &record : records) {
+            auto threadId = (record.category == TraceCategory::gpu) ? gpuThreadId : buffer->getThreadId();
+            auto duration = record.end > record.start ? record.end - record.start : 0u;
+            out << ",\n{\"name\":\"" << record.name << "\",\"cat\":\"" << getCategoryName(record.category)
+                << "\",\"ph\":\"X\",\"pid\":" << processId << ",\"tid\":" << threadId
+                << ",\"ts\":" << formatMicroseconds(record.start) << ",\"dur\":" << formatMicroseconds(duration)
+                << ",\"args\":{\"arg\":" << record.arg << "}}";
+        }
+    }
+    out << "\n]}\n";
+}
+
+bool TraceRecorder::exportTraceToFile() const {
+    std::ofstream file(outputFileName, std::ios::out | std::ios::trunc);
+    if (!file.good()) {
+        return false;
+    }
+    exportTrace(file);
+    return file.good();
+}
+} // namespace NEO
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace NEO {
+
+enum class TraceCategory : uint32_t {
+    api = 0,
+    enqueue,
+    submission,
+    system,
+    gpu,
+    count
+};
+
+struct TraceRecord {
+    const char *name = nullptr;
+    uint64_t start = 0;
+    uint64_t end = 0;
+    uint64_t arg = 0;
+    TraceCategory category = TraceCategory::api;
+};
+
+// Single producer ring buffer, written only by its owning thread.
+// When full, the oldest records are overwritten. Buffer released by an exited thread is reused by the next new thread.
+class TraceRecorderThreadBuffer {
+  public:
+    TraceRecorderThreadBuffer(uint32_t threadId, size_t capacity) : records(capacity), threadId(threadId) {}
+
+    void push(const TraceRecord &record) {
+        auto position = writeIndex.load(std::memory_order_relaxed);
+        records[position % records.size()] = record;
+        writeIndex.store(position + 1, std::memory_order_release);
+    }
+
+    // Copies records that were not overwritten during the copy, oldest first.
+    void snapshot(std::vector<TraceRecord> &out) const;
+
+    uint32_t getThreadId() const { return threadId; }
+    size_t getCapacity() const { return records.size(); }
+
+    std::atomic<bool> inUse{true};
+
+  protected:
+    std::vector<TraceRecord> records;
+    std::atomic<uint64_t> writeIndex{0u};
+    uint32_t threadId;
+};
+
+// Collects host and GPU spans into per-thread ring buffers and exports them
+// as a Chrome trace / Perfetto compatible JSON. Recording does not take any lock,
+// a lock is taken only when a thread records its first span. Trace requested with SIGUSR2 is written by a dedicated thread.
+class TraceRecorder {
+  public:
+    static constexpr size_t defaultRecordsPerThread = 64 * 1024;
+    static constexpr uint32_t gpuThreadId = 0u;
+
+    static TraceRecorder &get();
+    static bool isEnabled() {
+        return DebugManager.flags.EnableTraceRecorder.get() == 1;
+    }
+    static uint64_t getTimestamp();
+    static const char *getCategoryName(TraceCategory category);
+
+    TraceRecorder(size_t recordsPerThread, const std::string &outputFileName);
+    ~TraceRecorder();
+
+    TraceRecorder(const TraceRecorder &) = delete;
+    TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+    void recordSpan(TraceCategory category, const char *name, uint64_t start, uint64_t end, uint64_t arg = 0) {
+        TraceRecord record;
+        record.name = name;
+        record.start = start;
+        record.end = end;
+        record.arg = arg;
+        record.category = category;
+        getThreadBuffer().push(record);
+    }
+
+    // Returns a pointer that stays valid for the lifetime of the recorder, for names that are not string literals
+    const char *storeName(const std::string &name);
+
+    void exportTrace(std::ostream &out) const;
+    bool exportTraceToFile() const;
+
+    size_t getThreadBuffersCount() const;
+
+  protected:
+    TraceRecorderThreadBuffer &getThreadBuffer();
+    std::shared_ptr<TraceRecorderThreadBuffer> registerThreadBuffer();
+
+    static void registerDumpSignalHandler(TraceRecorder &recorder);
+    static void unregisterDumpSignalHandler(TraceRecorder &recorder);
+    static uint32_t getProcessId();
+
+    static std::atomic<uint64_t> recorderIdCounter;
+    const uint64_t recorderId;
+    const size_t recordsPerThread;
+    const std::string outputFileName;
+
+    mutable std::mutex buffersMutex;
+    std::vector<std::shared_ptr<TraceRecorderThreadBuffer>> buffers;
+
+    std::mutex namesMutex;
+    std::unordered_set<std::string> names;
+};
+
+struct TraceRecorderScope {
+    TraceRecorderScope(TraceCategory category, const char *name) : name(name), category(category) {
+        if (TraceRecorder::isEnabled()) {
+            start = TraceRecorder::getTimestamp();
+        }
+    }
+
+    ~TraceRecorderScope() {
+        if (start != 0) {
+            TraceRecorder::get().recordSpan(category, name, start, TraceRecorder::getTimestamp());
+        }
+    }
+
+    const char *name;
+    uint64_t start = 0;
+    TraceCategory category;
+};
+} // namespace NEO
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_recorder.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+void TraceRecorder::registerDumpSignalHandler(TraceRecorder &recorder) {
+}
+
+void TraceRecorder::unregisterDumpSignalHandler(TraceRecorder &recorder) {
+}
+
+uint32_t TraceRecorder::getProcessId() {
+    return static_cast<uint32_t>(GetCurrentProcessId());
+}
+} // namespace NEO
@@ -15,6 +15,7 @@
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "opencl/test/unit_test/fixtures/device_fixture.h"
 #include "opencl/test/unit_test/global_environment.h"
+#include "opencl/test/unit_test/helpers/test_files.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_program.h"
 #include "test.h"
@@ -37,7 +38,11 @@ class CompilerCacheMock : public CompilerCache {
     }
 
     std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
-        return loadResult ? std::unique_ptr<char[]>{new char[1]} : nullptr;
+        if (loadResult) {
+            cachedBinarySize = 1u;
+            return std::unique_ptr<char[]>{new char[1]};
+        }
+        return nullptr;
     }
 
     bool cacheResult = false;
@@ -220,6 +225,25 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheTests, givenEmptyOptionsAndDifferentCompilerRevisionsWhenHashIsComputedThenHashesDiffer) {
+    HardwareInfo hwInfo = *platformDevices[0];
+    const char src[] = "kernel source";
+    const char firstRevision[] = "1:libigc.so:100:200";
+    const char secondRevision[] = "1:libigc.so:100:300";
+
+    auto hashWithoutRevision = CompilerCache::getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src) - 1), ArrayRef<const char>(), ArrayRef<const char>());
+    auto firstHash = CompilerCache::getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src) - 1), ArrayRef<const char>(), ArrayRef<const char>(),
+                                                      ArrayRef<const char>(firstRevision, sizeof(firstRevision) - 1));
+    auto secondHash = CompilerCache::getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src) - 1), ArrayRef<const char>(), ArrayRef<const char>(),
+                                                       ArrayRef<const char>(secondRevision, sizeof(secondRevision) - 1));
+
+    EXPECT_STRNE(hashWithoutRevision.c_str(), firstHash.c_str());
+    EXPECT_STRNE(firstHash.c_str(), secondHash.c_str());
+    EXPECT_STREQ(firstHash.c_str(), CompilerCache::getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src) - 1), ArrayRef<const char>(), ArrayRef<const char>(),
+                                                                     ArrayRef<const char>(firstRevision, sizeof(firstRevision) - 1))
+                                        .c_str());
+}
+
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     CompilerCache cache(CompilerCacheConfig{});
     bool ret = cache.cacheBinary("some_hash", nullptr, 12u);
@@ -369,3 +393,40 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
 
     gEnvironment->fclPopDebugVars();
 }
+
+TEST(CompilerInterfaceCachedTests, givenSipBinaryInCacheWhenSipKernelBinaryIsRequestedThenIgcIsNotCalled) {
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    MockDevice device;
+    std::vector<char> sipBinary;
+    auto err = compilerInterface->getSipKernelBinary(device, SipKernelType::Csr, sipBinary);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_EQ(1u, sipBinary.size());
+
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenSipBinaryNotInCacheWhenSipKernelBinaryIsRequestedThenCompiledBinaryIsCached) {
+    MockCompilerDebugVars igcDebugVars;
+    retrieveBinaryKernelFilename(igcDebugVars.fileName, "CopyBuffer_simd16_", ".bc");
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheMock();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCacheMock>(cache), true));
+
+    MockDevice device;
+    std::vector<char> sipBinary;
+    auto err = compilerInterface->getSipKernelBinary(device, SipKernelType::Csr, sipBinary);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_NE(0u, sipBinary.size());
+    EXPECT_EQ(1u, cache->cacheInvoked);
+
+    gEnvironment->igcPopDebugVars();
+}
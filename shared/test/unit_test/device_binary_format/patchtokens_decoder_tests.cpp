@@ -1212,3 +1212,58 @@ TEST(ProgramDecoder, GivenProgramWithMultipleKernelsWhenFailsToDecodeKernelThenD
     EXPECT_EQ(2U, decodedProgram.header->NumberOfKernels);
     EXPECT_EQ(1U, decodedProgram.kernels.size());
 }
+
+TEST(ProgramDecoder, GivenProgramWithManyKernelsWhenKernelsAreDecodedInParallelThenAllKernelsAreDecodedInOrder) {
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    constexpr uint32_t numKernels = 32U;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    auto firstKernelOffset = programToEncode.storage.size() - kernelBlob.size();
+    for (uint32_t i = 1; i < numKernels; ++i) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+
+    auto prevValue = NEO::PatchTokenBinary::minKernelsCountForParallelDecode;
+    NEO::PatchTokenBinary::minKernelsCountForParallelDecode = 1U;
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    NEO::PatchTokenBinary::minKernelsCountForParallelDecode = prevValue;
+
+    EXPECT_TRUE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.decodeStatus);
+    ASSERT_EQ(numKernels, decodedProgram.kernels.size());
+    for (uint32_t i = 0; i < numKernels; ++i) {
+        auto &decodedKernel = decodedProgram.kernels[i];
+        EXPECT_EQ(NEO::DecodeError::Success, decodedKernel.decodeStatus) << i;
+        EXPECT_EQ(programToEncode.storage.data() + firstKernelOffset + i * kernelBlob.size(), decodedKernel.blobs.kernelInfo.begin()) << i;
+        EXPECT_EQ(kernelBlob.size(), decodedKernel.blobs.kernelInfo.size()) << i;
+        EXPECT_NE(nullptr, decodedKernel.tokens.allocateLocalSurface) << i;
+    }
+}
+
+TEST(ProgramDecoder, GivenProgramWithManyKernelsWhenKernelsAreDecodedInParallelAndOneFailsThenDecodingFailsAndStopsAtFailedKernel) {
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    constexpr uint32_t numKernels = 8U;
+    constexpr uint32_t invalidKernelId = 5U;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    auto slmOffsetInKernel = programToEncode.slmMutableOffset - (programToEncode.storage.size() - kernelBlob.size());
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    for (uint32_t i = 1; i < numKernels; ++i) {
+        auto kernelOffset = programToEncode.storage.size();
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+        if (i == invalidKernelId) {
+            reinterpret_cast<iOpenCL::SPatchAllocateLocalSurface *>(programToEncode.storage.data() + kernelOffset + slmOffsetInKernel)->Size = 0U;
+        }
+    }
+
+    auto prevValue = NEO::PatchTokenBinary::minKernelsCountForParallelDecode;
+    NEO::PatchTokenBinary::minKernelsCountForParallelDecode = 1U;
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    NEO::PatchTokenBinary::minKernelsCountForParallelDecode = prevValue;
+
+    EXPECT_FALSE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.decodeStatus);
+    ASSERT_EQ(invalidKernelId + 1, decodedProgram.kernels.size());
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.kernels[invalidKernelId].decodeStatus);
+}
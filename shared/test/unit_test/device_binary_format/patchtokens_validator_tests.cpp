@@ -522,3 +522,24 @@ TEST(PatchtokensValidator, GivenKernelWhenExecutionEnvironmentHasInvalidSimdSize
 TEST(PatchtokensValidator, GivenDefaultStateThenUnhandledPatchtokensAreAllowed) {
     EXPECT_TRUE(NEO::PatchTokenBinary::allowUnhandledTokens);
 }
+
+TEST(PatchtokensValidator, GivenProgramWithManyKernelsWhenKernelsAreValidatedInParallelThenFirstInvalidKernelIsReported) {
+    PatchTokensTestData::ValidProgramWithKernel prog;
+    std::string error, warning;
+    constexpr uint32_t numKernels = 16U;
+    for (uint32_t i = 1; i < numKernels; ++i) {
+        prog.kernels.push_back(prog.kernels[0]);
+    }
+
+    auto prevValue = NEO::PatchTokenBinary::minKernelsCountForParallelDecode;
+    NEO::PatchTokenBinary::minKernelsCountForParallelDecode = 1U;
+    EXPECT_EQ(NEO::DecodeError::Success, NEO::PatchTokenBinary::validate(prog, error, warning));
+    EXPECT_TRUE(error.empty());
+    EXPECT_TRUE(warning.empty());
+
+    prog.kernels[7].tokens.executionEnvironment = nullptr;
+    prog.kernels[11].decodeStatus = NEO::DecodeError::InvalidBinary;
+    EXPECT_EQ(NEO::DecodeError::UnhandledBinary, NEO::PatchTokenBinary::validate(prog, error, warning));
+    NEO::PatchTokenBinary::minKernelsCountForParallelDecode = prevValue;
+    EXPECT_STREQ("Missing execution environment", error.c_str());
+}
@@ -5,9 +5,12 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/page_fault_manager/cpu_page_fault_manager_tests_fixture.h"
 
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
@@ -110,6 +113,33 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocsWhenMovingToGpuDomainAllocs
     EXPECT_FALSE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenAllocsMovedToGpuDomainWhenOnlyOneIsAccessedByCpuThenOnlyThisAllocIsMovedAgain) {
+    unifiedMemoryManager = reinterpret_cast<void *>(0x1111);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+
+    void *alloc1 = reinterpret_cast<void *>(0x1);
+    void *alloc2 = reinterpret_cast<void *>(0x100);
+
+    pageFaultManager->insertAllocation(alloc1, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ);
+    pageFaultManager->insertAllocation(alloc2, 20, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ);
+    EXPECT_EQ(2u, pageFaultManager->cpuDomainAllocations[reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager)].size());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+    EXPECT_TRUE(pageFaultManager->cpuDomainAllocations[reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager)].empty());
+
+    pageFaultManager->verifyPageFault(alloc2);
+    EXPECT_EQ(1u, pageFaultManager->cpuDomainAllocations[reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager)].size());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 3);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc2);
+
+    pageFaultManager->removeAllocation(alloc1);
+    pageFaultManager->removeAllocation(alloc2);
+    EXPECT_TRUE(pageFaultManager->cpuDomainAllocations[reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager)].empty());
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenMoveToGpuDomainThenTransferToGpuIsCalled) {
     void *cmdQ = reinterpret_cast<void *>(0xFFFF);
 
@@ -201,6 +231,23 @@ TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProper
     EXPECT_TRUE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenTrackedAllocsWhenPageFaultIsOutsideOfAllAllocsThenItIsNotHandled) {
+    void *alloc1 = reinterpret_cast<void *>(0x1000);
+    void *alloc2 = reinterpret_cast<void *>(0x3000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+    pageFaultManager->insertAllocation(alloc2, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x500)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x2000)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x4000)));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 2);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x3FFF)));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 3);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, alloc2);
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableIsCalledThenAllocIsAubWritable) {
     MockExecutionEnvironment executionEnvironment;
     if (!executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo()->capabilityTable.ftrSvm) {
@@ -219,3 +266,97 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableIsCalledTh
 
     unifiedMemoryManager->freeSVMAlloc(alloc1);
 }
+
+TEST_F(PageFaultManagerTest, givenAllocationBiggerThanChunkWhenInsertedThenItStartsInCpuDomainAndIsMigratedToGpuAsWhole) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PageFaultManagerChunkSizeInKb.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+    unifiedMemoryManager = reinterpret_cast<void *>(0x1111);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    auto size = 3 * chunkSize + 0x100;
+
+    pageFaultManager->insertAllocation(alloc, size, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ);
+    EXPECT_EQ(4u, pageFaultManager->memoryData[alloc].chunks.size());
+    EXPECT_FALSE(pageFaultManager->memoryData[alloc].isInGpuDomain);
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(alloc, pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(size, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(0, pageFaultManager->protectMemoryCalled);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(alloc, pageFaultManager->transferToGpuAddress);
+    EXPECT_EQ(0, pageFaultManager->transferChunksToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(alloc, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(size, pageFaultManager->protectedSize);
+    for (auto chunkState : pageFaultManager->memoryData[alloc].chunks) {
+        EXPECT_EQ(MockPageFaultManager::ChunkState::gpu, chunkState);
+    }
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].isInGpuDomain);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocationBiggerThanChunkWhenCpuReadsAndWritesChunksThenOnlyTouchedChunksAreMigratedAndWrittenChunkIsMarkedDirty) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PageFaultManagerChunkSizeInKb.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+    unifiedMemoryManager = reinterpret_cast<void *>(0x1111);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    auto readChunk = ptrOffset(alloc, chunkSize);
+    auto writtenChunk = ptrOffset(alloc, 3 * chunkSize);
+
+    pageFaultManager->insertAllocation(alloc, 3 * chunkSize + 0x100, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(readChunk, 0x10)));
+    EXPECT_EQ(1, pageFaultManager->allowMemoryReadAccessCalled);
+    EXPECT_EQ(readChunk, pageFaultManager->allowedMemoryReadAccessAddress);
+    EXPECT_EQ(1, pageFaultManager->transferChunkToCpuCalled);
+    EXPECT_EQ(readChunk, pageFaultManager->transferChunkToCpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferChunkToCpuSize);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(writtenChunk, 0x10)));
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(writtenChunk, 0x10)));
+    EXPECT_EQ(2, pageFaultManager->transferChunkToCpuCalled);
+    EXPECT_EQ(0x100u, pageFaultManager->transferChunkToCpuSize);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(writtenChunk, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(MockPageFaultManager::ChunkState::gpu, pageFaultManager->memoryData[alloc].chunks[0]);
+    EXPECT_EQ(MockPageFaultManager::ChunkState::cpuClean, pageFaultManager->memoryData[alloc].chunks[1]);
+    EXPECT_EQ(MockPageFaultManager::ChunkState::cpuDirty, pageFaultManager->memoryData[alloc].chunks[3]);
+    EXPECT_FALSE(pageFaultManager->memoryData[alloc].isInGpuDomain);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferChunksToGpuCalled);
+    ASSERT_EQ(1u, pageFaultManager->transferredCleanChunksToGpu.size());
+    EXPECT_EQ(readChunk, pageFaultManager->transferredCleanChunksToGpu[0]);
+    ASSERT_EQ(1u, pageFaultManager->transferredDirtyChunksToGpu.size());
+    EXPECT_EQ(writtenChunk, pageFaultManager->transferredDirtyChunksToGpu[0]);
+    EXPECT_EQ(3, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(writtenChunk, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(0x100u, pageFaultManager->protectedSize);
+    EXPECT_FALSE(pageFaultManager->isAubWritable);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].isInGpuDomain);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferChunksToGpuCalled);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedMigrationDisabledWhenBigAllocationIsInsertedThenWholeAllocationIsTransferred) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(0u, PageFaultManager::getChunkSize());
+    DebugManager.flags.PageFaultManagerChunkSizeInKb.set(0);
+    EXPECT_EQ(0u, PageFaultManager::getChunkSize());
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    size_t size = 4 * MemoryConstants::megaByte;
+
+    pageFaultManager->insertAllocation(alloc, size, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].chunks.empty());
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(size, pageFaultManager->transferToCpuSize);
+}
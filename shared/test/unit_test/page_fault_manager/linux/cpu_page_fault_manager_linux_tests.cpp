@@ -5,13 +5,17 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/page_fault_manager/linux/cpu_page_fault_manager_linux.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/page_fault_manager/mock_cpu_page_fault_manager.h"
 
 #include "gtest/gtest.h"
 
 #include <csignal>
 #include <sys/mman.h>
+#include <vector>
 
 using namespace NEO;
 using MockPageFaultManagerLinux = MockPageFaultManagerHandlerInvoke<PageFaultManagerLinux>;
@@ -144,3 +148,70 @@ TEST(PageFaultManagerLinuxTest, givenIgnoringSaHandlerWhenInvokeCallPreviousSaHa
     mockPageFaultManager.reset();
     sigaction(SIGSEGV, &originalHandler, nullptr);
 }
+
+class MockChunkTransferPageFaultManager : public PageFaultManagerLinux {
+  public:
+    using PageFaultManagerLinux::ChunkState;
+    using PageFaultManagerLinux::memoryData;
+
+    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {}
+    void transferToGpu(void *ptr, void *cmdQ) override {
+        transferredToGpu.push_back(ptr);
+    }
+    void transferChunkToCpu(void *ptr, size_t size, void *cmdQ) override {
+        transferredToCpu.push_back(ptr);
+    }
+    void transferChunksToGpu(const std::vector<void *> &cleanChunkPtrs, const std::vector<void *> &dirtyChunkPtrs, void *cmdQ) override {
+        transferredCleanChunksToGpu.insert(transferredCleanChunksToGpu.end(), cleanChunkPtrs.begin(), cleanChunkPtrs.end());
+        transferredDirtyChunksToGpu.insert(transferredDirtyChunksToGpu.end(), dirtyChunkPtrs.begin(), dirtyChunkPtrs.end());
+    }
+    void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+
+    std::vector<void *> transferredToCpu;
+    std::vector<void *> transferredToGpu;
+    std::vector<void *> transferredCleanChunksToGpu;
+    std::vector<void *> transferredDirtyChunksToGpu;
+};
+
+TEST(PageFaultManagerLinuxTest, givenChunkedAllocationInGpuDomainWhenCpuReadsOneChunkAndWritesAnotherThenOnlyWrittenChunkIsDirtyAndMigratedBack) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PageFaultManagerChunkSizeInKb.set(64);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+    constexpr size_t size = 4 * chunkSize;
+
+    auto pageFaultManager = std::make_unique<MockChunkTransferPageFaultManager>();
+    auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    ASSERT_NE(MAP_FAILED, ptr);
+    auto readChunk = ptrOffset(ptr, chunkSize);
+    auto writtenChunk = ptrOffset(ptr, 2 * chunkSize);
+
+    pageFaultManager->insertAllocation(ptr, size, nullptr, nullptr);
+    pageFaultManager->moveAllocationToGpuDomain(ptr);
+    ASSERT_EQ(1u, pageFaultManager->transferredToGpu.size());
+    EXPECT_EQ(ptr, pageFaultManager->transferredToGpu[0]);
+
+    int value = static_cast<volatile int *>(readChunk)[1];
+    EXPECT_EQ(0, value);
+    static_cast<volatile int *>(writtenChunk)[1] = 10;
+    EXPECT_EQ(10, static_cast<volatile int *>(writtenChunk)[1]);
+
+    ASSERT_EQ(2u, pageFaultManager->transferredToCpu.size());
+    EXPECT_EQ(readChunk, pageFaultManager->transferredToCpu[0]);
+    EXPECT_EQ(writtenChunk, pageFaultManager->transferredToCpu[1]);
+
+    auto &chunks = pageFaultManager->memoryData[ptr].chunks;
+    EXPECT_EQ(MockChunkTransferPageFaultManager::ChunkState::gpu, chunks[0]);
+    EXPECT_EQ(MockChunkTransferPageFaultManager::ChunkState::cpuClean, chunks[1]);
+    EXPECT_EQ(MockChunkTransferPageFaultManager::ChunkState::cpuDirty, chunks[2]);
+    EXPECT_EQ(MockChunkTransferPageFaultManager::ChunkState::gpu, chunks[3]);
+
+    pageFaultManager->moveAllocationToGpuDomain(ptr);
+    EXPECT_EQ(1u, pageFaultManager->transferredToGpu.size());
+    ASSERT_EQ(1u, pageFaultManager->transferredCleanChunksToGpu.size());
+    EXPECT_EQ(readChunk, pageFaultManager->transferredCleanChunksToGpu[0]);
+    ASSERT_EQ(1u, pageFaultManager->transferredDirtyChunksToGpu.size());
+    EXPECT_EQ(writtenChunk, pageFaultManager->transferredDirtyChunksToGpu[0]);
+
+    pageFaultManager->removeAllocation(ptr);
+    munmap(ptr, size);
+}
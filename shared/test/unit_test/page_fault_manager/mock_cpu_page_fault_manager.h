@@ -14,6 +14,8 @@ using namespace NEO;
 class MockPageFaultManager : public PageFaultManager {
   public:
     using PageFaultManager::memoryData;
+    using PageFaultManager::ChunkState;
+    using PageFaultManager::cpuDomainAllocations;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
     using PageFaultManager::verifyPageFault;
@@ -23,6 +25,11 @@ class MockPageFaultManager : public PageFaultManager {
         allowedMemoryAccessAddress = ptr;
         accessAllowedSize = size;
     }
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override {
+        allowMemoryReadAccessCalled++;
+        allowedMemoryReadAccessAddress = ptr;
+        readAccessAllowedSize = size;
+    }
     void protectCPUMemoryAccess(void *ptr, size_t size) override {
         protectMemoryCalled++;
         protectedMemoryAccessAddress = ptr;
@@ -37,6 +44,16 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferChunkToCpu(void *ptr, size_t size, void *cmdQ) override {
+        transferChunkToCpuCalled++;
+        transferChunkToCpuAddress = ptr;
+        transferChunkToCpuSize = size;
+    }
+    void transferChunksToGpu(const std::vector<void *> &cleanChunkPtrs, const std::vector<void *> &dirtyChunkPtrs, void *cmdQ) override {
+        transferChunksToGpuCalled++;
+        transferredCleanChunksToGpu = cleanChunkPtrs;
+        transferredDirtyChunksToGpu = dirtyChunkPtrs;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -49,17 +66,32 @@ class MockPageFaultManager : public PageFaultManager {
     void baseGpuTransfer(void *ptr, void *cmdQ) {
         PageFaultManager::transferToGpu(ptr, cmdQ);
     }
+    void baseChunkCpuTransfer(void *ptr, size_t size, void *cmdQ) {
+        PageFaultManager::transferChunkToCpu(ptr, size, cmdQ);
+    }
+    void baseChunksGpuTransfer(const std::vector<void *> &cleanChunkPtrs, const std::vector<void *> &dirtyChunkPtrs, void *cmdQ) {
+        PageFaultManager::transferChunksToGpu(cleanChunkPtrs, dirtyChunkPtrs, cmdQ);
+    }
 
     int allowMemoryAccessCalled = 0;
+    int allowMemoryReadAccessCalled = 0;
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferChunkToCpuCalled = 0;
+    int transferChunksToGpuCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
+    void *transferChunkToCpuAddress = nullptr;
+    std::vector<void *> transferredCleanChunksToGpu;
+    std::vector<void *> transferredDirtyChunksToGpu;
     void *allowedMemoryAccessAddress = nullptr;
+    void *allowedMemoryReadAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferChunkToCpuSize = 0;
     size_t accessAllowedSize = 0;
+    size_t readAccessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
 };
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenNoJobsWhenParallelForIsCalledThenFunctionIsNotCalled) {
+    uint32_t callsCount = 0;
+    parallelFor(0U, 4U, [&](size_t) { ++callsCount; });
+    EXPECT_EQ(0U, callsCount);
+}
+
+TEST(ParallelForTest, givenSingleWorkerWhenParallelForIsCalledThenJobsAreExecutedInOrderOnCallingThread) {
+    std::vector<size_t> executedJobs;
+    auto callingThreadId = std::this_thread::get_id();
+    parallelFor(5U, 1U, [&](size_t jobId) {
+        EXPECT_EQ(callingThreadId, std::this_thread::get_id());
+        executedJobs.push_back(jobId);
+    });
+    EXPECT_EQ((std::vector<size_t>{0U, 1U, 2U, 3U, 4U}), executedJobs);
+}
+
+TEST(ParallelForTest, givenMultipleWorkersWhenParallelForIsCalledThenEveryJobIsExecutedExactlyOnce) {
+    constexpr size_t jobsCount = 1000U;
+    std::vector<std::atomic<uint32_t>> executionsPerJob(jobsCount);
+    for (auto &executions : executionsPerJob) {
+        executions = 0U;
+    }
+    parallelFor(jobsCount, 8U, [&](size_t jobId) { ++executionsPerJob[jobId]; });
+    for (size_t jobId = 0; jobId < jobsCount; ++jobId) {
+        EXPECT_EQ(1U, executionsPerJob[jobId].load()) << jobId;
+    }
+}
+
+TEST(ParallelForTest, givenMoreWorkersThanAllowedWhenParallelForIsCalledThenWorkersCountIsCapped) {
+    constexpr size_t jobsCount = 4 * maxParallelForWorkersCount;
+    std::mutex threadIdsMutex;
+    std::set<std::thread::id> threadIds;
+    parallelFor(jobsCount, jobsCount, [&](size_t jobId) {
+        std::lock_guard<std::mutex> lock(threadIdsMutex);
+        threadIds.insert(std::this_thread::get_id());
+    });
+    EXPECT_GE(maxParallelForWorkersCount, threadIds.size());
+}
+
+TEST(ParallelForTest, whenDefaultWorkersCountIsQueriedThenAtLeastOneWorkerIsReturned) {
+    EXPECT_LE(1U, getDefaultWorkersCount());
+}
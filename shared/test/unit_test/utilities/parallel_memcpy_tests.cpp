@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_memcpy.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>(i * 7 + i / 251);
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(ParallelMemcpyTest, givenDefaultSettingsWhenCheckingSmallCopyThenParallelCopyIsNotPreferred) {
+    EXPECT_FALSE(ParallelMemcpy::isParallelCopyPreferred(ParallelMemcpy::defaultMinSizeForParallelCopy - 1));
+    EXPECT_EQ(1U, ParallelMemcpy::getWorkersCount(ParallelMemcpy::chunkSize));
+}
+
+TEST(ParallelMemcpyTest, givenParallelMemcpyDisabledWhenCheckingLargeCopyThenParallelCopyIsNotPreferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableParallelMemcpy.set(0);
+    EXPECT_FALSE(ParallelMemcpy::isParallelCopyPreferred(64 * ParallelMemcpy::defaultMinSizeForParallelCopy));
+}
+
+TEST(ParallelMemcpyTest, givenUnalignedPointersAndSizesWhenCopyingWithNonTemporalStoresThenDataIsCopied) {
+    auto src = createPattern(1024);
+    for (size_t offset : {0U, 1U, 7U, 15U}) {
+        for (size_t size : {0U, 3U, 16U, 33U, 1000U}) {
+            std::vector<uint8_t> dst(1024 + 16, 0xFF);
+            ParallelMemcpy::copyNonTemporal(dst.data() + offset, src.data() + 3, size);
+            EXPECT_EQ(0, memcmp(dst.data() + offset, src.data() + 3, size));
+            EXPECT_EQ(0xFF, dst[offset + size]);
+        }
+    }
+}
+
+TEST(ParallelMemcpyTest, givenLoweredThresholdWhenCopyingUnalignedRangeThenWholeRangeIsCopied) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelMemcpyMinSizeInKb.set(0);
+
+    size_t size = 5 * ParallelMemcpy::chunkSize + 123;
+    auto src = createPattern(size + 1);
+    std::vector<uint8_t> dst(size + 2, 0);
+
+    EXPECT_EQ(0, parallelMemcpy(dst.data() + 1, size, src.data() + 1, size));
+    EXPECT_EQ(0, memcmp(dst.data() + 1, src.data() + 1, size));
+    EXPECT_EQ(0, dst[0]);
+    EXPECT_EQ(0, dst[size + 1]);
+}
+
+TEST(ParallelMemcpyTest, givenInvalidArgumentsWhenCopyingThenMemcpySErrorIsReturned) {
+    uint8_t src[4] = {};
+    uint8_t dst[4] = {};
+    EXPECT_EQ(-EINVAL, parallelMemcpy(nullptr, sizeof(dst), src, sizeof(src)));
+    EXPECT_EQ(-ERANGE, parallelMemcpy(dst, sizeof(dst) - 1, src, sizeof(src)));
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/runtime_counters.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct RuntimeCountersTest : public ::testing::Test {
+    void SetUp() override {
+        RuntimeCounters::reset();
+    }
+    void TearDown() override {
+        RuntimeCounters::reset();
+    }
+};
+
+TEST_F(RuntimeCountersTest, givenCounterIncrementedFromManyThreadsWhenValueIsReadThenAllIncrementsAreCounted) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([]() {
+            for (int j = 0; j < 1000; j++) {
+                RuntimeCounters::increment(RuntimeCounter::flushTasks);
+                RuntimeCounters::increment(RuntimeCounter::bytesMadeResident, 4096u);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(4000u, RuntimeCounters::getValue(RuntimeCounter::flushTasks));
+    EXPECT_EQ(4000u * 4096u, RuntimeCounters::getValue(RuntimeCounter::bytesMadeResident));
+    EXPECT_EQ(0u, RuntimeCounters::getValue(RuntimeCounter::execCalls));
+}
+
+TEST_F(RuntimeCountersTest, givenAllocationsCountedWhenTypeOrPoolIsOutOfRangeThenLastSlotIsUsed) {
+    RuntimeCounters::incrementAllocations(3u, 1u);
+    RuntimeCounters::incrementAllocations(3u, 6u);
+    RuntimeCounters::incrementAllocations(1000u, 1000u);
+
+    EXPECT_EQ(3u, RuntimeCounters::getValue(RuntimeCounter::allocations));
+    EXPECT_EQ(2u, RuntimeCounters::getAllocationsByType(3u));
+    EXPECT_EQ(1u, RuntimeCounters::getAllocationsByType(RuntimeCounters::maxAllocationTypes - 1));
+    EXPECT_EQ(1u, RuntimeCounters::getAllocationsByPool(1u));
+    EXPECT_EQ(1u, RuntimeCounters::getAllocationsByPool(6u));
+    EXPECT_EQ(1u, RuntimeCounters::getAllocationsByPool(RuntimeCounters::maxMemoryPools - 1));
+}
+
+TEST_F(RuntimeCountersTest, givenCountersWhenValuesAndNamesAreQueriedThenEachValueHasName) {
+    RuntimeCounters::increment(RuntimeCounter::waitSpinTimeNs, 123u);
+    RuntimeCounters::incrementAllocations(2u, 6u);
+
+    std::vector<uint64_t> values(RuntimeCounters::valuesCount + 1, 0u);
+    EXPECT_EQ(RuntimeCounters::valuesCount, RuntimeCounters::getValues(values.data(), values.size()));
+
+    std::stringstream names(RuntimeCounters::getNames());
+    std::vector<std::string> namesList;
+    std::string name;
+    while (std::getline(names, name)) {
+        namesList.push_back(name);
+    }
+    ASSERT_EQ(RuntimeCounters::valuesCount, namesList.size());
+
+    auto waitSpinTimeIndex = static_cast<uint32_t>(RuntimeCounter::waitSpinTimeNs);
+    EXPECT_EQ("waitSpinTimeNs", namesList[waitSpinTimeIndex]);
+    EXPECT_EQ(123u, values[waitSpinTimeIndex]);
+    EXPECT_EQ("allocationsByType[2]", namesList[RuntimeCounters::allocationsByTypeIndex + 2]);
+    EXPECT_EQ(1u, values[RuntimeCounters::allocationsByTypeIndex + 2]);
+    EXPECT_EQ("allocationsByPool[6]", namesList[RuntimeCounters::allocationsByPoolIndex + 6]);
+    EXPECT_EQ(1u, values[RuntimeCounters::allocationsByPoolIndex + 6]);
+}
+
+TEST_F(RuntimeCountersTest, givenCountersWhenDumpedThenAllCountersAndOnlyUsedAllocationSlotsArePrinted) {
+    RuntimeCounters::increment(RuntimeCounter::compilerCacheMisses, 2u);
+    RuntimeCounters::incrementAllocations(5u, 1u);
+
+    std::stringstream out;
+    RuntimeCounters::dump(out);
+    auto dump = out.str();
+
+    EXPECT_NE(std::string::npos, dump.find("flushTasks = 0\n"));
+    EXPECT_NE(std::string::npos, dump.find("compilerCacheMisses = 2\n"));
+    EXPECT_NE(std::string::npos, dump.find("allocations = 1\n"));
+    EXPECT_NE(std::string::npos, dump.find("allocationsByType[5] = 1\n"));
+    EXPECT_NE(std::string::npos, dump.find("allocationsByPool[1] = 1\n"));
+    EXPECT_EQ(std::string::npos, dump.find("allocationsByType[0]"));
+    EXPECT_EQ(std::string::npos, dump.find("allocationsByPool[0]"));
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_recorder.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MockTraceRecorder : public TraceRecorder {
+    using TraceRecorder::getThreadBuffer;
+    using TraceRecorder::TraceRecorder;
+};
+
+TEST(TraceRecorderTest, givenSpansRecordedOnTwoThreadsWhenTraceIsExportedThenEachThreadHasOwnTimeline) {
+    MockTraceRecorder traceRecorder(16u, "");
+
+    traceRecorder.recordSpan(TraceCategory::api, "mainThreadSpan", 1000u, 3500u);
+    std::thread workerThread([&]() {
+        traceRecorder.recordSpan(TraceCategory::submission, "workerThreadSpan", 2000u, 2001u);
+    });
+    workerThread.join();
+    EXPECT_EQ(2u, traceRecorder.getThreadBuffersCount());
+
+    std::stringstream trace;
+    traceRecorder.exportTrace(trace);
+    auto traceString = trace.str();
+
+    EXPECT_NE(std::string::npos, traceString.find("{\"name\":\"mainThreadSpan\",\"cat\":\"api\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, traceString.find("\"tid\":1,\"ts\":1.000,\"dur\":2.500"));
+    EXPECT_NE(std::string::npos, traceString.find("{\"name\":\"workerThreadSpan\",\"cat\":\"submission\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, traceString.find("\"tid\":2,\"ts\":2.000,\"dur\":0.001"));
+    EXPECT_EQ(0u, traceString.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, traceString.find("\n]}\n"));
+}
+
+TEST(TraceRecorderTest, givenGpuSpanWhenTraceIsExportedThenSpanIsPlacedOnGpuTimeline) {
+    MockTraceRecorder traceRecorder(16u, "");
+    traceRecorder.recordSpan(TraceCategory::gpu, traceRecorder.storeName(std::string("CL_COMMAND_NDRANGE_KERNEL")), 1000u, 2000u, 7u);
+
+    std::stringstream trace;
+    traceRecorder.exportTrace(trace);
+
+    EXPECT_NE(std::string::npos, trace.str().find("{\"name\":\"CL_COMMAND_NDRANGE_KERNEL\",\"cat\":\"gpu\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.str().find("\"tid\":0,\"ts\":1.000,\"dur\":1.000,\"args\":{\"arg\":7}"));
+}
+
+TEST(TraceRecorderTest, givenFullThreadBufferWhenMoreSpansAreRecordedThenOldestSpansAreOverwritten) {
+    MockTraceRecorder traceRecorder(4u, "");
+    for (uint64_t i = 0; i < 6; i++) {
+        traceRecorder.recordSpan(TraceCategory::api, "span", i, i + 1, i);
+    }
+
+    // oldest record of full buffer may be under write by owning thread, so it is never exported
+    std::vector<TraceRecord> records;
+    traceRecorder.getThreadBuffer().snapshot(records);
+    ASSERT_EQ(3u, records.size());
+    for (uint64_t i = 0; i < 3; i++) {
+        EXPECT_EQ(i + 3, records[i].arg);
+    }
+}
+
+TEST(TraceRecorderTest, givenSameNameStoredTwiceWhenStoreNameIsCalledThenSamePointerIsReturned) {
+    MockTraceRecorder traceRecorder(4u, "");
+    auto name = traceRecorder.storeName(std::string("CL_COMMAND_READ_BUFFER"));
+    EXPECT_STREQ("CL_COMMAND_READ_BUFFER", name);
+    EXPECT_EQ(name, traceRecorder.storeName(std::string("CL_COMMAND_READ_BUFFER")));
+}
+
+TEST(TraceRecorderTest, givenThreadThatRecordedSpanExitedWhenNextThreadRecordsSpanThenThreadBufferIsReused) {
+    MockTraceRecorder traceRecorder(16u, "");
+
+    std::thread firstThread([&]() {
+        traceRecorder.recordSpan(TraceCategory::api, "firstThreadSpan", 1000u, 2000u);
+    });
+    firstThread.join();
+    std::thread secondThread([&]() {
+        traceRecorder.recordSpan(TraceCategory::api, "secondThreadSpan", 3000u, 4000u);
+    });
+    secondThread.join();
+    EXPECT_EQ(1u, traceRecorder.getThreadBuffersCount());
+
+    std::stringstream trace;
+    traceRecorder.exportTrace(trace);
+    EXPECT_NE(std::string::npos, trace.str().find("{\"name\":\"firstThreadSpan\""));
+    EXPECT_NE(std::string::npos, trace.str().find("{\"name\":\"secondThreadSpan\""));
+}